@@ -22,6 +22,7 @@
 
 list (APPEND MAIN_SOURCE_FILES
       src/opm/common/data/SimulationDataContainer.cpp
+      src/opm/common/OpmLog/AsyncLogBackend.cpp
       src/opm/common/OpmLog/CounterLog.cpp
       src/opm/common/OpmLog/EclipsePRTLog.cpp
       src/opm/common/OpmLog/LogBackend.cpp
@@ -157,6 +158,9 @@ if(ENABLE_ECL_INPUT)
     src/opm/parser/eclipse/EclipseState/Schedule/VFPProdTable.cpp
     src/opm/parser/eclipse/Parser/ErrorGuard.cpp
     src/opm/parser/eclipse/Parser/ParseContext.cpp
+    src/opm/parser/eclipse/Parser/ParseProfile.cpp
+    src/opm/parser/eclipse/Parser/BuiltinKeywords.cpp
+    src/opm/parser/eclipse/Parser/DeckCache.cpp
     src/opm/parser/eclipse/Parser/Parser.cpp
     src/opm/parser/eclipse/Parser/ParserEnums.cpp
     src/opm/parser/eclipse/Parser/ParserItem.cpp
@@ -302,6 +306,7 @@ if(ENABLE_ECL_INPUT)
     tests/parser/PYACTION.cpp
     tests/parser/PORVTests.cpp
     tests/parser/RawKeywordTests.cpp
+    tests/parser/RawScannerTests.cpp
     tests/parser/ResinsightTest.cpp
     tests/parser/RestartConfigTests.cpp
     tests/parser/RockTableTests.cpp
@@ -431,6 +436,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/ErrorMacros.hpp
       opm/common/Exceptions.hpp
       opm/common/data/SimulationDataContainer.hpp
+      opm/common/OpmLog/AsyncLogBackend.hpp
       opm/common/OpmLog/CounterLog.hpp
       opm/common/OpmLog/EclipsePRTLog.hpp
       opm/common/OpmLog/LogBackend.hpp
@@ -476,6 +482,7 @@ if(ENABLE_ECL_INPUT)
        opm/parser/eclipse/Units/Units.hpp
        opm/parser/eclipse/Units/Dimension.hpp
        opm/parser/eclipse/Parser/ErrorGuard.hpp
+       opm/parser/eclipse/Parser/IncludeCache.hpp
        opm/parser/eclipse/Parser/ParserItem.hpp
        opm/parser/eclipse/Parser/Parser.hpp
        opm/parser/eclipse/Parser/ParserRecord.hpp
@@ -483,6 +490,7 @@ if(ENABLE_ECL_INPUT)
        opm/parser/eclipse/Parser/InputErrorAction.hpp
        opm/parser/eclipse/Parser/ParserEnums.hpp
        opm/parser/eclipse/Parser/ParseContext.hpp
+       opm/parser/eclipse/Parser/ParseProfile.hpp
        opm/parser/eclipse/Parser/ParserConst.hpp
        opm/parser/eclipse/EclipseState/InitConfig/InitConfig.hpp
        opm/parser/eclipse/EclipseState/InitConfig/Equil.hpp
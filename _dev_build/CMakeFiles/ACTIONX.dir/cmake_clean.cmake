@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ACTIONX.dir/tests/parser/ACTIONX.cpp.o"
+  "CMakeFiles/ACTIONX.dir/tests/parser/ACTIONX.cpp.o.d"
+  "bin/ACTIONX"
+  "bin/ACTIONX.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ACTIONX.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
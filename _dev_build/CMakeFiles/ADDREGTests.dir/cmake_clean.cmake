@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ADDREGTests.dir/tests/parser/ADDREGTests.cpp.o"
+  "CMakeFiles/ADDREGTests.dir/tests/parser/ADDREGTests.cpp.o.d"
+  "bin/ADDREGTests"
+  "bin/ADDREGTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ADDREGTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AquanconTests.dir/tests/parser/AquanconTests.cpp.o"
+  "CMakeFiles/AquanconTests.dir/tests/parser/AquanconTests.cpp.o.d"
+  "bin/AquanconTests"
+  "bin/AquanconTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AquanconTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AqudimsTests.dir/tests/parser/AqudimsTests.cpp.o"
+  "CMakeFiles/AqudimsTests.dir/tests/parser/AqudimsTests.cpp.o.d"
+  "bin/AqudimsTests"
+  "bin/AqudimsTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AqudimsTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AquiferCTTests.dir/tests/parser/AquiferCTTests.cpp.o"
+  "CMakeFiles/AquiferCTTests.dir/tests/parser/AquiferCTTests.cpp.o.d"
+  "bin/AquiferCTTests"
+  "bin/AquiferCTTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AquiferCTTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
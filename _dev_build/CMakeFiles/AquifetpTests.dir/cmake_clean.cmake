@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/AquifetpTests.dir/tests/parser/AquifetpTests.cpp.o"
+  "CMakeFiles/AquifetpTests.dir/tests/parser/AquifetpTests.cpp.o.d"
+  "bin/AquifetpTests"
+  "bin/AquifetpTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AquifetpTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
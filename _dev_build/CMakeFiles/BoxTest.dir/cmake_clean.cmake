@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/BoxTest.dir/tests/parser/integration/BoxTest.cpp.o"
+  "CMakeFiles/BoxTest.dir/tests/parser/integration/BoxTest.cpp.o.d"
+  "bin/BoxTest"
+  "bin/BoxTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BoxTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/BoxTests.dir/tests/parser/BoxTests.cpp.o"
+  "CMakeFiles/BoxTests.dir/tests/parser/BoxTests.cpp.o.d"
+  "bin/BoxTests"
+  "bin/BoxTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BoxTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
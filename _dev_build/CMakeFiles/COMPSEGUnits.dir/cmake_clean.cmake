@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/COMPSEGUnits.dir/tests/parser/COMPSEGUnits.cpp.o"
+  "CMakeFiles/COMPSEGUnits.dir/tests/parser/COMPSEGUnits.cpp.o.d"
+  "bin/COMPSEGUnits"
+  "bin/COMPSEGUnits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/COMPSEGUnits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CheckDeckValidity.dir/tests/parser/integration/CheckDeckValidity.cpp.o"
+  "CMakeFiles/CheckDeckValidity.dir/tests/parser/integration/CheckDeckValidity.cpp.o.d"
+  "bin/CheckDeckValidity"
+  "bin/CheckDeckValidity.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CheckDeckValidity.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
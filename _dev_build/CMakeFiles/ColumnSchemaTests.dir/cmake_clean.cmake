@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ColumnSchemaTests.dir/tests/parser/ColumnSchemaTests.cpp.o"
+  "CMakeFiles/ColumnSchemaTests.dir/tests/parser/ColumnSchemaTests.cpp.o.d"
+  "bin/ColumnSchemaTests"
+  "bin/ColumnSchemaTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ColumnSchemaTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ConnectionTests.dir/tests/parser/ConnectionTests.cpp.o"
+  "CMakeFiles/ConnectionTests.dir/tests/parser/ConnectionTests.cpp.o.d"
+  "bin/ConnectionTests"
+  "bin/ConnectionTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ConnectionTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
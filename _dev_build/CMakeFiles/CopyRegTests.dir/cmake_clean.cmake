@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CopyRegTests.dir/tests/parser/CopyRegTests.cpp.o"
+  "CMakeFiles/CopyRegTests.dir/tests/parser/CopyRegTests.cpp.o.d"
+  "bin/CopyRegTests"
+  "bin/CopyRegTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CopyRegTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
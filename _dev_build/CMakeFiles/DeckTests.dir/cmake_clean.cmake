@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DeckTests.dir/tests/parser/DeckTests.cpp.o"
+  "CMakeFiles/DeckTests.dir/tests/parser/DeckTests.cpp.o.d"
+  "bin/DeckTests"
+  "bin/DeckTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DeckTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DeckValueTests.dir/tests/parser/DeckValueTests.cpp.o"
+  "CMakeFiles/DeckValueTests.dir/tests/parser/DeckValueTests.cpp.o.d"
+  "bin/DeckValueTests"
+  "bin/DeckValueTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DeckValueTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
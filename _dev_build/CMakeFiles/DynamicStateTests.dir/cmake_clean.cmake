@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DynamicStateTests.dir/tests/parser/DynamicStateTests.cpp.o"
+  "CMakeFiles/DynamicStateTests.dir/tests/parser/DynamicStateTests.cpp.o.d"
+  "bin/DynamicStateTests"
+  "bin/DynamicStateTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DynamicStateTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DynamicVectorTests.dir/tests/parser/DynamicVectorTests.cpp.o"
+  "CMakeFiles/DynamicVectorTests.dir/tests/parser/DynamicVectorTests.cpp.o.d"
+  "bin/DynamicVectorTests"
+  "bin/DynamicVectorTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DynamicVectorTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/EDITNNCTests.dir/tests/parser/integration/EDITNNCTests.cpp.o"
+  "CMakeFiles/EDITNNCTests.dir/tests/parser/integration/EDITNNCTests.cpp.o.d"
+  "bin/EDITNNCTests"
+  "bin/EDITNNCTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/EDITNNCTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Eclipse3DPropertiesTests.dir/tests/parser/Eclipse3DPropertiesTests.cpp.o"
+  "CMakeFiles/Eclipse3DPropertiesTests.dir/tests/parser/Eclipse3DPropertiesTests.cpp.o.d"
+  "bin/Eclipse3DPropertiesTests"
+  "bin/Eclipse3DPropertiesTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Eclipse3DPropertiesTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
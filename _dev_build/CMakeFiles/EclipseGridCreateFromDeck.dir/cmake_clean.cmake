@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/EclipseGridCreateFromDeck.dir/tests/parser/integration/EclipseGridCreateFromDeck.cpp.o"
+  "CMakeFiles/EclipseGridCreateFromDeck.dir/tests/parser/integration/EclipseGridCreateFromDeck.cpp.o.d"
+  "bin/EclipseGridCreateFromDeck"
+  "bin/EclipseGridCreateFromDeck.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/EclipseGridCreateFromDeck.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/EclipseGridTests.dir/tests/parser/EclipseGridTests.cpp.o"
+  "CMakeFiles/EclipseGridTests.dir/tests/parser/EclipseGridTests.cpp.o.d"
+  "bin/EclipseGridTests"
+  "bin/EclipseGridTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/EclipseGridTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/EclipseStateTests.dir/tests/parser/EclipseStateTests.cpp.o"
+  "CMakeFiles/EclipseStateTests.dir/tests/parser/EclipseStateTests.cpp.o.d"
+  "bin/EclipseStateTests"
+  "bin/EclipseStateTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/EclipseStateTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/EmbeddedPython.dir/tests/parser/EmbeddedPython.cpp.o"
+  "CMakeFiles/EmbeddedPython.dir/tests/parser/EmbeddedPython.cpp.o.d"
+  "bin/EmbeddedPython"
+  "bin/EmbeddedPython.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/EmbeddedPython.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/EqualRegTests.dir/tests/parser/EqualRegTests.cpp.o"
+  "CMakeFiles/EqualRegTests.dir/tests/parser/EqualRegTests.cpp.o.d"
+  "bin/EqualRegTests"
+  "bin/EqualRegTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/EqualRegTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/EventTests.dir/tests/parser/EventTests.cpp.o"
+  "CMakeFiles/EventTests.dir/tests/parser/EventTests.cpp.o.d"
+  "bin/EventTests"
+  "bin/EventTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/EventTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Debug".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "opmcommon" for configuration "Debug"
+set_property(TARGET opmcommon APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(opmcommon PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_DEBUG "C;CXX"
+  IMPORTED_LINK_INTERFACE_LIBRARIES_DEBUG "Boost::system;Boost::filesystem;Boost::unit_test_framework;Boost::regex;/usr/lib/x86_64-linux-gnu/libboost_system.so.1.74.0;/usr/lib/x86_64-linux-gnu/libboost_system.so;/usr/lib/x86_64-linux-gnu/libboost_filesystem.so.1.74.0;/usr/lib/x86_64-linux-gnu/libboost_filesystem.so;/usr/lib/x86_64-linux-gnu/libboost_unit_test_framework.so.1.74.0;/usr/lib/x86_64-linux-gnu/libboost_unit_test_framework.so;/usr/lib/x86_64-linux-gnu/libboost_regex.so;/usr/lib/x86_64-linux-gnu/libz.so"
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libopmcommon.a"
+  )
+
+list(APPEND _cmake_import_check_targets opmcommon )
+list(APPEND _cmake_import_check_files_for_opmcommon "${_IMPORT_PREFIX}/lib/libopmcommon.a" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/FaceDirTests.dir/tests/parser/FaceDirTests.cpp.o"
+  "CMakeFiles/FaceDirTests.dir/tests/parser/FaceDirTests.cpp.o.d"
+  "bin/FaceDirTests"
+  "bin/FaceDirTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FaceDirTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/FaultTests.dir/tests/parser/FaultTests.cpp.o"
+  "CMakeFiles/FaultTests.dir/tests/parser/FaultTests.cpp.o.d"
+  "bin/FaultTests"
+  "bin/FaultTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FaultTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/FoamTests.dir/tests/parser/FoamTests.cpp.o"
+  "CMakeFiles/FoamTests.dir/tests/parser/FoamTests.cpp.o.d"
+  "bin/FoamTests"
+  "bin/FoamTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FoamTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/FunctionalTests.dir/tests/parser/FunctionalTests.cpp.o"
+  "CMakeFiles/FunctionalTests.dir/tests/parser/FunctionalTests.cpp.o.d"
+  "bin/FunctionalTests"
+  "bin/FunctionalTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FunctionalTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GeomodifierTests.dir/tests/parser/GeomodifierTests.cpp.o"
+  "CMakeFiles/GeomodifierTests.dir/tests/parser/GeomodifierTests.cpp.o.d"
+  "bin/GeomodifierTests"
+  "bin/GeomodifierTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GeomodifierTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GridPropertyTests.dir/tests/parser/GridPropertyTests.cpp.o"
+  "CMakeFiles/GridPropertyTests.dir/tests/parser/GridPropertyTests.cpp.o.d"
+  "bin/GridPropertyTests"
+  "bin/GridPropertyTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GridPropertyTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
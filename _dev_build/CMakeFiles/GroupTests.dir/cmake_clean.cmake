@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GroupTests.dir/tests/parser/GroupTests.cpp.o"
+  "CMakeFiles/GroupTests.dir/tests/parser/GroupTests.cpp.o.d"
+  "bin/GroupTests"
+  "bin/GroupTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GroupTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
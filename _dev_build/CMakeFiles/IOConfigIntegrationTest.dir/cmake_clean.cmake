@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/IOConfigIntegrationTest.dir/tests/parser/integration/IOConfigIntegrationTest.cpp.o"
+  "CMakeFiles/IOConfigIntegrationTest.dir/tests/parser/integration/IOConfigIntegrationTest.cpp.o.d"
+  "bin/IOConfigIntegrationTest"
+  "bin/IOConfigIntegrationTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/IOConfigIntegrationTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
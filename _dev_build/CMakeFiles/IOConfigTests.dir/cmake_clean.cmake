@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/IOConfigTests.dir/tests/parser/IOConfigTests.cpp.o"
+  "CMakeFiles/IOConfigTests.dir/tests/parser/IOConfigTests.cpp.o.d"
+  "bin/IOConfigTests"
+  "bin/IOConfigTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/IOConfigTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/IncludeTest.dir/tests/parser/integration/IncludeTest.cpp.o"
+  "CMakeFiles/IncludeTest.dir/tests/parser/integration/IncludeTest.cpp.o.d"
+  "bin/IncludeTest"
+  "bin/IncludeTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/IncludeTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/InitConfigTest.dir/tests/parser/InitConfigTest.cpp.o"
+  "CMakeFiles/InitConfigTest.dir/tests/parser/InitConfigTest.cpp.o.d"
+  "bin/InitConfigTest"
+  "bin/InitConfigTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/InitConfigTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
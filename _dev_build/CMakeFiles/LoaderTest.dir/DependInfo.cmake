@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/opm/parser/eclipse/Generator/KeywordLoader.cpp" "CMakeFiles/LoaderTest.dir/src/opm/parser/eclipse/Generator/KeywordLoader.cpp.o" "gcc" "CMakeFiles/LoaderTest.dir/src/opm/parser/eclipse/Generator/KeywordLoader.cpp.o.d"
+  "/root/repo/tests/parser/KeywordLoaderTests.cpp" "CMakeFiles/LoaderTest.dir/tests/parser/KeywordLoaderTests.cpp.o" "gcc" "CMakeFiles/LoaderTest.dir/tests/parser/KeywordLoaderTests.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dev_build/CMakeFiles/opmcommon.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
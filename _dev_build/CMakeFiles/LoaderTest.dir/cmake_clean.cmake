@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LoaderTest.dir/src/opm/parser/eclipse/Generator/KeywordLoader.cpp.o"
+  "CMakeFiles/LoaderTest.dir/src/opm/parser/eclipse/Generator/KeywordLoader.cpp.o.d"
+  "CMakeFiles/LoaderTest.dir/tests/parser/KeywordLoaderTests.cpp.o"
+  "CMakeFiles/LoaderTest.dir/tests/parser/KeywordLoaderTests.cpp.o.d"
+  "bin/LoaderTest"
+  "bin/LoaderTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LoaderTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MULTREGTScannerTests.dir/tests/parser/MULTREGTScannerTests.cpp.o"
+  "CMakeFiles/MULTREGTScannerTests.dir/tests/parser/MULTREGTScannerTests.cpp.o.d"
+  "bin/MULTREGTScannerTests"
+  "bin/MULTREGTScannerTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MULTREGTScannerTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
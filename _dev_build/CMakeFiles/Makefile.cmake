@@ -0,0 +1,336 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CMakeLists_files.cmake"
+  "/root/repo/ExtraTests.cmake"
+  "/root/repo/GenerateKeywords.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "doc/doxygen/Doxyfile.in"
+  "/root/repo/cmake/Modules/AddOptions.cmake"
+  "/root/repo/cmake/Modules/BoostTargets.cmake"
+  "/root/repo/cmake/Modules/CheckCaseSensitiveFileSystem.cmake"
+  "/root/repo/cmake/Modules/ConfigVars.cmake"
+  "/root/repo/cmake/Modules/Duplicates.cmake"
+  "/root/repo/cmake/Modules/FindC99.cmake"
+  "/root/repo/cmake/Modules/FindCXX11Features.cmake"
+  "/root/repo/cmake/Modules/FindCppCheck.cmake"
+  "/root/repo/cmake/Modules/Findopm-tests.cmake"
+  "/root/repo/cmake/Modules/LibtoolArchives.cmake"
+  "/root/repo/cmake/Modules/OpmAliases.cmake"
+  "/root/repo/cmake/Modules/OpmCompile.cmake"
+  "/root/repo/cmake/Modules/OpmDefaults.cmake"
+  "/root/repo/cmake/Modules/OpmDistClean.cmake"
+  "/root/repo/cmake/Modules/OpmDoc.cmake"
+  "/root/repo/cmake/Modules/OpmFiles.cmake"
+  "/root/repo/cmake/Modules/OpmFind.cmake"
+  "/root/repo/cmake/Modules/OpmInit.cmake"
+  "/root/repo/cmake/Modules/OpmInstall.cmake"
+  "/root/repo/cmake/Modules/OpmKnown.cmake"
+  "/root/repo/cmake/Modules/OpmLibMain.cmake"
+  "/root/repo/cmake/Modules/OpmPackage.cmake"
+  "/root/repo/cmake/Modules/OpmProject.cmake"
+  "/root/repo/cmake/Modules/OpmSatellites.cmake"
+  "/root/repo/cmake/Modules/OpmSiblingSearch.cmake"
+  "/root/repo/cmake/Modules/UseCompVer.cmake"
+  "/root/repo/cmake/Modules/UseDebugSymbols.cmake"
+  "/root/repo/cmake/Modules/UseDynamicBoost.cmake"
+  "/root/repo/cmake/Modules/UseFastBuilds.cmake"
+  "/root/repo/cmake/Modules/UseOnlyNeeded.cmake"
+  "/root/repo/cmake/Modules/UseOpenMP.cmake"
+  "/root/repo/cmake/Modules/UseOptimization.cmake"
+  "/root/repo/cmake/Modules/UsePrecompHeaders.cmake"
+  "/root/repo/cmake/Modules/UseStaticAnalysis.cmake"
+  "/root/repo/cmake/Modules/UseSystemInfo.cmake"
+  "/root/repo/cmake/Modules/UseThreads.cmake"
+  "/root/repo/cmake/Modules/UseVCSInfo.cmake"
+  "/root/repo/cmake/Modules/UseVersion.cmake"
+  "/root/repo/cmake/Modules/UseWarnings.cmake"
+  "/root/repo/cmake/Templates/opm-project-config-version.cmake.in"
+  "/root/repo/cmake/Templates/opm-project-config.cmake.in"
+  "/root/repo/cmake/Templates/opm-project.pc.in"
+  "/root/repo/dune.module"
+  "/root/repo/opm-common-prereqs.cmake"
+  "/root/repo/src/opm/parser/eclipse/keyword_list.argv.in"
+  "/root/repo/src/opm/parser/eclipse/share/keywords/keyword_list.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/BoostDetectToolset-1.74.0.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/boost_filesystem-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/boost_filesystem-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/libboost_filesystem-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/libboost_filesystem-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/boost_regex-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/boost_regex-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/libboost_regex-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/libboost_regex-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/boost_system-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/boost_system-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/libboost_system-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/libboost_system-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/boost_unit_test_framework-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/boost_unit_test_framework-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/libboost_unit_test_framework-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_unit_test_framework-1.74.0/libboost_unit_test_framework-variant-static.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenMP.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/TestCXXAcceptsFlag.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "keyword_list.argv"
+  "opm-common-config.cmake"
+  "opm-common-config-version.cmake"
+  "opm-common.pc"
+  "opm-common-install.cmake"
+  "opm-common-install.pc"
+  "DartConfiguration.tcl"
+  "doc/doxygen/Doxyfile"
+  "dunemod.tmp"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/genkw.dir/DependInfo.cmake"
+  "CMakeFiles/opmcommon.dir/DependInfo.cmake"
+  "CMakeFiles/examples.dir/DependInfo.cmake"
+  "CMakeFiles/opmi.dir/DependInfo.cmake"
+  "CMakeFiles/opmpack.dir/DependInfo.cmake"
+  "CMakeFiles/opmhash.dir/DependInfo.cmake"
+  "CMakeFiles/additionals.dir/DependInfo.cmake"
+  "CMakeFiles/attic.dir/DependInfo.cmake"
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/check.dir/DependInfo.cmake"
+  "CMakeFiles/inlinekw.dir/DependInfo.cmake"
+  "CMakeFiles/test-suite.dir/DependInfo.cmake"
+  "CMakeFiles/LoaderTest.dir/DependInfo.cmake"
+  "CMakeFiles/ParserTests.dir/DependInfo.cmake"
+  "CMakeFiles/ParserIncludeTests.dir/DependInfo.cmake"
+  "CMakeFiles/PvtxTableTests.dir/DependInfo.cmake"
+  "CMakeFiles/EclipseStateTests.dir/DependInfo.cmake"
+  "CMakeFiles/BoxTest.dir/DependInfo.cmake"
+  "CMakeFiles/CheckDeckValidity.dir/DependInfo.cmake"
+  "CMakeFiles/EclipseGridCreateFromDeck.dir/DependInfo.cmake"
+  "CMakeFiles/EDITNNCTests.dir/DependInfo.cmake"
+  "CMakeFiles/IncludeTest.dir/DependInfo.cmake"
+  "CMakeFiles/IntegrationTests.dir/DependInfo.cmake"
+  "CMakeFiles/IOConfigIntegrationTest.dir/DependInfo.cmake"
+  "CMakeFiles/NNCTests.dir/DependInfo.cmake"
+  "CMakeFiles/ParseKEYWORD.dir/DependInfo.cmake"
+  "CMakeFiles/Polymer.dir/DependInfo.cmake"
+  "CMakeFiles/ScheduleCreateFromDeck.dir/DependInfo.cmake"
+  "CMakeFiles/TransMultIntegrationTests.dir/DependInfo.cmake"
+  "CMakeFiles/jsonTests.dir/DependInfo.cmake"
+  "CMakeFiles/datafiles.dir/DependInfo.cmake"
+  "CMakeFiles/tests.dir/DependInfo.cmake"
+  "CMakeFiles/test_calculateCellVol.dir/DependInfo.cmake"
+  "CMakeFiles/test_cmp.dir/DependInfo.cmake"
+  "CMakeFiles/test_cubic.dir/DependInfo.cmake"
+  "CMakeFiles/test_messagelimiter.dir/DependInfo.cmake"
+  "CMakeFiles/test_nonuniformtablelinear.dir/DependInfo.cmake"
+  "CMakeFiles/test_OpmLog.dir/DependInfo.cmake"
+  "CMakeFiles/test_param.dir/DependInfo.cmake"
+  "CMakeFiles/test_SimulationDataContainer.dir/DependInfo.cmake"
+  "CMakeFiles/test_sparsevector.dir/DependInfo.cmake"
+  "CMakeFiles/test_uniformtablelinear.dir/DependInfo.cmake"
+  "CMakeFiles/ACTIONX.dir/DependInfo.cmake"
+  "CMakeFiles/ADDREGTests.dir/DependInfo.cmake"
+  "CMakeFiles/AquiferCTTests.dir/DependInfo.cmake"
+  "CMakeFiles/AquifetpTests.dir/DependInfo.cmake"
+  "CMakeFiles/AqudimsTests.dir/DependInfo.cmake"
+  "CMakeFiles/AquanconTests.dir/DependInfo.cmake"
+  "CMakeFiles/BoxTests.dir/DependInfo.cmake"
+  "CMakeFiles/ColumnSchemaTests.dir/DependInfo.cmake"
+  "CMakeFiles/ConnectionTests.dir/DependInfo.cmake"
+  "CMakeFiles/COMPSEGUnits.dir/DependInfo.cmake"
+  "CMakeFiles/CopyRegTests.dir/DependInfo.cmake"
+  "CMakeFiles/DeckValueTests.dir/DependInfo.cmake"
+  "CMakeFiles/DeckTests.dir/DependInfo.cmake"
+  "CMakeFiles/DynamicStateTests.dir/DependInfo.cmake"
+  "CMakeFiles/DynamicVectorTests.dir/DependInfo.cmake"
+  "CMakeFiles/Eclipse3DPropertiesTests.dir/DependInfo.cmake"
+  "CMakeFiles/EclipseGridTests.dir/DependInfo.cmake"
+  "CMakeFiles/EmbeddedPython.dir/DependInfo.cmake"
+  "CMakeFiles/EqualRegTests.dir/DependInfo.cmake"
+  "CMakeFiles/EventTests.dir/DependInfo.cmake"
+  "CMakeFiles/FaceDirTests.dir/DependInfo.cmake"
+  "CMakeFiles/FaultTests.dir/DependInfo.cmake"
+  "CMakeFiles/FoamTests.dir/DependInfo.cmake"
+  "CMakeFiles/FunctionalTests.dir/DependInfo.cmake"
+  "CMakeFiles/GeomodifierTests.dir/DependInfo.cmake"
+  "CMakeFiles/GridPropertyTests.dir/DependInfo.cmake"
+  "CMakeFiles/GroupTests.dir/DependInfo.cmake"
+  "CMakeFiles/InitConfigTest.dir/DependInfo.cmake"
+  "CMakeFiles/IOConfigTests.dir/DependInfo.cmake"
+  "CMakeFiles/MessageLimitTests.dir/DependInfo.cmake"
+  "CMakeFiles/MultiRegTests.dir/DependInfo.cmake"
+  "CMakeFiles/MultisegmentWellTests.dir/DependInfo.cmake"
+  "CMakeFiles/MULTREGTScannerTests.dir/DependInfo.cmake"
+  "CMakeFiles/OrderedMapTests.dir/DependInfo.cmake"
+  "CMakeFiles/ParseContextTests.dir/DependInfo.cmake"
+  "CMakeFiles/ParseContext_EXIT1.dir/DependInfo.cmake"
+  "CMakeFiles/ParseDATAWithDefault.dir/DependInfo.cmake"
+  "CMakeFiles/PYACTION.dir/DependInfo.cmake"
+  "CMakeFiles/PORVTests.dir/DependInfo.cmake"
+  "CMakeFiles/RawKeywordTests.dir/DependInfo.cmake"
+  "CMakeFiles/RawScannerTests.dir/DependInfo.cmake"
+  "CMakeFiles/ResinsightTest.dir/DependInfo.cmake"
+  "CMakeFiles/RestartConfigTests.dir/DependInfo.cmake"
+  "CMakeFiles/RockTableTests.dir/DependInfo.cmake"
+  "CMakeFiles/RunspecTests.dir/DependInfo.cmake"
+  "CMakeFiles/SatfuncPropertyInitializersTests.dir/DependInfo.cmake"
+  "CMakeFiles/ScheduleTests.dir/DependInfo.cmake"
+  "CMakeFiles/SectionTests.dir/DependInfo.cmake"
+  "CMakeFiles/SimpleTableTests.dir/DependInfo.cmake"
+  "CMakeFiles/SimulationConfigTest.dir/DependInfo.cmake"
+  "CMakeFiles/StarTokenTests.dir/DependInfo.cmake"
+  "CMakeFiles/StringTests.dir/DependInfo.cmake"
+  "CMakeFiles/SummaryConfigTests.dir/DependInfo.cmake"
+  "CMakeFiles/TabdimsTests.dir/DependInfo.cmake"
+  "CMakeFiles/TableColumnTests.dir/DependInfo.cmake"
+  "CMakeFiles/TableContainerTests.dir/DependInfo.cmake"
+  "CMakeFiles/TableManagerTests.dir/DependInfo.cmake"
+  "CMakeFiles/TableSchemaTests.dir/DependInfo.cmake"
+  "CMakeFiles/ThresholdPressureTest.dir/DependInfo.cmake"
+  "CMakeFiles/TimeMapTest.dir/DependInfo.cmake"
+  "CMakeFiles/TransMultTests.dir/DependInfo.cmake"
+  "CMakeFiles/TuningTests.dir/DependInfo.cmake"
+  "CMakeFiles/UDQTests.dir/DependInfo.cmake"
+  "CMakeFiles/UnitTests.dir/DependInfo.cmake"
+  "CMakeFiles/ValueTests.dir/DependInfo.cmake"
+  "CMakeFiles/WellSolventTests.dir/DependInfo.cmake"
+  "CMakeFiles/WellTracerTests.dir/DependInfo.cmake"
+  "CMakeFiles/WellTests.dir/DependInfo.cmake"
+  "CMakeFiles/WLIST.dir/DependInfo.cmake"
+  "CMakeFiles/WTEST.dir/DependInfo.cmake"
+  "CMakeFiles/test_AggregateActionxData.dir/DependInfo.cmake"
+  "CMakeFiles/test_AggregateWellData.dir/DependInfo.cmake"
+  "CMakeFiles/test_AggregateGroupData.dir/DependInfo.cmake"
+  "CMakeFiles/test_AggregateMSWData.dir/DependInfo.cmake"
+  "CMakeFiles/test_AggregateConnectionData.dir/DependInfo.cmake"
+  "CMakeFiles/test_AggregateUDQData.dir/DependInfo.cmake"
+  "CMakeFiles/test_ArrayDimChecker.dir/DependInfo.cmake"
+  "CMakeFiles/test_EclipseIO.dir/DependInfo.cmake"
+  "CMakeFiles/test_DoubHEAD.dir/DependInfo.cmake"
+  "CMakeFiles/test_InteHEAD.dir/DependInfo.cmake"
+  "CMakeFiles/test_LinearisedOutputTable.dir/DependInfo.cmake"
+  "CMakeFiles/test_LogiHEAD.dir/DependInfo.cmake"
+  "CMakeFiles/test_OutputStream.dir/DependInfo.cmake"
+  "CMakeFiles/test_regionCache.dir/DependInfo.cmake"
+  "CMakeFiles/test_PaddedOutputString.dir/DependInfo.cmake"
+  "CMakeFiles/test_Restart.dir/DependInfo.cmake"
+  "CMakeFiles/test_RFT.dir/DependInfo.cmake"
+  "CMakeFiles/test_Solution.dir/DependInfo.cmake"
+  "CMakeFiles/test_Summary.dir/DependInfo.cmake"
+  "CMakeFiles/test_Tables.dir/DependInfo.cmake"
+  "CMakeFiles/test_Wells.dir/DependInfo.cmake"
+  "CMakeFiles/test_WindowedArray.dir/DependInfo.cmake"
+  "CMakeFiles/test_restartwellinfo.dir/DependInfo.cmake"
+  "CMakeFiles/check-commits.dir/DependInfo.cmake"
+  "CMakeFiles/distclean.dir/DependInfo.cmake"
+  "CMakeFiles/opm-common-benchmarks.dir/DependInfo.cmake"
+  "CMakeFiles/deckgenerator.dir/DependInfo.cmake"
+  "CMakeFiles/bench_deck_output.dir/DependInfo.cmake"
+  "CMakeFiles/bench_parser.dir/DependInfo.cmake"
+  "CMakeFiles/bench_raw_records.dir/DependInfo.cmake"
+  "CMakeFiles/bench_raw_scanner.dir/DependInfo.cmake"
+  "CMakeFiles/bench_star_token.dir/DependInfo.cmake"
+  "CMakeFiles/compareECL.dir/DependInfo.cmake"
+  "CMakeFiles/convertECL.dir/DependInfo.cmake"
+  "CMakeFiles/test_EclFilesComparator.dir/DependInfo.cmake"
+  "CMakeFiles/test_EclRegressionTest.dir/DependInfo.cmake"
+  "CMakeFiles/test_EclIO.dir/DependInfo.cmake"
+  "CMakeFiles/test_EGrid.dir/DependInfo.cmake"
+  "CMakeFiles/test_ERft.dir/DependInfo.cmake"
+  "CMakeFiles/test_ERst.dir/DependInfo.cmake"
+  "CMakeFiles/test_ESmry.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MessageLimitTests.dir/tests/parser/MessageLimitTests.cpp.o"
+  "CMakeFiles/MessageLimitTests.dir/tests/parser/MessageLimitTests.cpp.o.d"
+  "bin/MessageLimitTests"
+  "bin/MessageLimitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MessageLimitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MultiRegTests.dir/tests/parser/MultiRegTests.cpp.o"
+  "CMakeFiles/MultiRegTests.dir/tests/parser/MultiRegTests.cpp.o.d"
+  "bin/MultiRegTests"
+  "bin/MultiRegTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MultiRegTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MultisegmentWellTests.dir/tests/parser/MultisegmentWellTests.cpp.o"
+  "CMakeFiles/MultisegmentWellTests.dir/tests/parser/MultisegmentWellTests.cpp.o.d"
+  "bin/MultisegmentWellTests"
+  "bin/MultisegmentWellTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MultisegmentWellTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
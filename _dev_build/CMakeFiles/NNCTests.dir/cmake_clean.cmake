@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/NNCTests.dir/tests/parser/integration/NNCTests.cpp.o"
+  "CMakeFiles/NNCTests.dir/tests/parser/integration/NNCTests.cpp.o.d"
+  "bin/NNCTests"
+  "bin/NNCTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/NNCTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/OrderedMapTests.dir/tests/parser/OrderedMapTests.cpp.o"
+  "CMakeFiles/OrderedMapTests.dir/tests/parser/OrderedMapTests.cpp.o.d"
+  "bin/OrderedMapTests"
+  "bin/OrderedMapTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/OrderedMapTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
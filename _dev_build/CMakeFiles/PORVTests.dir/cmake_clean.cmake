@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PORVTests.dir/tests/parser/PORVTests.cpp.o"
+  "CMakeFiles/PORVTests.dir/tests/parser/PORVTests.cpp.o.d"
+  "bin/PORVTests"
+  "bin/PORVTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PORVTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
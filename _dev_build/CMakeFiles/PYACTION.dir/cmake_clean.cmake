@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PYACTION.dir/tests/parser/PYACTION.cpp.o"
+  "CMakeFiles/PYACTION.dir/tests/parser/PYACTION.cpp.o.d"
+  "bin/PYACTION"
+  "bin/PYACTION.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PYACTION.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ParseContextTests.dir/tests/parser/ParseContextTests.cpp.o"
+  "CMakeFiles/ParseContextTests.dir/tests/parser/ParseContextTests.cpp.o.d"
+  "bin/ParseContextTests"
+  "bin/ParseContextTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ParseContextTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ParseContext_EXIT1.dir/tests/parser/ParseContext_EXIT1.cpp.o"
+  "CMakeFiles/ParseContext_EXIT1.dir/tests/parser/ParseContext_EXIT1.cpp.o.d"
+  "bin/ParseContext_EXIT1"
+  "bin/ParseContext_EXIT1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ParseContext_EXIT1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ParseDATAWithDefault.dir/tests/parser/ParseDATAWithDefault.cpp.o"
+  "CMakeFiles/ParseDATAWithDefault.dir/tests/parser/ParseDATAWithDefault.cpp.o.d"
+  "bin/ParseDATAWithDefault"
+  "bin/ParseDATAWithDefault.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ParseDATAWithDefault.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
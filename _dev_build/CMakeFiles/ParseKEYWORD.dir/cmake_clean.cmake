@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ParseKEYWORD.dir/tests/parser/integration/ParseKEYWORD.cpp.o"
+  "CMakeFiles/ParseKEYWORD.dir/tests/parser/integration/ParseKEYWORD.cpp.o.d"
+  "bin/ParseKEYWORD"
+  "bin/ParseKEYWORD.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ParseKEYWORD.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
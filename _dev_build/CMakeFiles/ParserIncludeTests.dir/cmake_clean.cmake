@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ParserIncludeTests.dir/tests/parser/ParserIncludeTests.cpp.o"
+  "CMakeFiles/ParserIncludeTests.dir/tests/parser/ParserIncludeTests.cpp.o.d"
+  "bin/ParserIncludeTests"
+  "bin/ParserIncludeTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ParserIncludeTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
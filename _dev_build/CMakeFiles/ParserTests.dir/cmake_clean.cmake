@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ParserTests.dir/tests/parser/ParserTests.cpp.o"
+  "CMakeFiles/ParserTests.dir/tests/parser/ParserTests.cpp.o.d"
+  "bin/ParserTests"
+  "bin/ParserTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ParserTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
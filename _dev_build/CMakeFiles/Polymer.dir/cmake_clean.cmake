@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Polymer.dir/tests/parser/integration/Polymer.cpp.o"
+  "CMakeFiles/Polymer.dir/tests/parser/integration/Polymer.cpp.o.d"
+  "bin/Polymer"
+  "bin/Polymer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Polymer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
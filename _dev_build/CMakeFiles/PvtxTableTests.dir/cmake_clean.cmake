@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PvtxTableTests.dir/tests/parser/PvtxTableTests.cpp.o"
+  "CMakeFiles/PvtxTableTests.dir/tests/parser/PvtxTableTests.cpp.o.d"
+  "bin/PvtxTableTests"
+  "bin/PvtxTableTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PvtxTableTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RawKeywordTests.dir/tests/parser/RawKeywordTests.cpp.o"
+  "CMakeFiles/RawKeywordTests.dir/tests/parser/RawKeywordTests.cpp.o.d"
+  "bin/RawKeywordTests"
+  "bin/RawKeywordTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RawKeywordTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
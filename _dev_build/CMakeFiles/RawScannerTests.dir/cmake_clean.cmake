@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RawScannerTests.dir/tests/parser/RawScannerTests.cpp.o"
+  "CMakeFiles/RawScannerTests.dir/tests/parser/RawScannerTests.cpp.o.d"
+  "bin/RawScannerTests"
+  "bin/RawScannerTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RawScannerTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ResinsightTest.dir/tests/parser/ResinsightTest.cpp.o"
+  "CMakeFiles/ResinsightTest.dir/tests/parser/ResinsightTest.cpp.o.d"
+  "bin/ResinsightTest"
+  "bin/ResinsightTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ResinsightTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
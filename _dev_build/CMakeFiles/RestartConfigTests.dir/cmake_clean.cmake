@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RestartConfigTests.dir/tests/parser/RestartConfigTests.cpp.o"
+  "CMakeFiles/RestartConfigTests.dir/tests/parser/RestartConfigTests.cpp.o.d"
+  "bin/RestartConfigTests"
+  "bin/RestartConfigTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RestartConfigTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
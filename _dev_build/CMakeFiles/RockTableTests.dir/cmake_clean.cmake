@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RockTableTests.dir/tests/parser/RockTableTests.cpp.o"
+  "CMakeFiles/RockTableTests.dir/tests/parser/RockTableTests.cpp.o.d"
+  "bin/RockTableTests"
+  "bin/RockTableTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RockTableTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RunspecTests.dir/tests/parser/RunspecTests.cpp.o"
+  "CMakeFiles/RunspecTests.dir/tests/parser/RunspecTests.cpp.o.d"
+  "bin/RunspecTests"
+  "bin/RunspecTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RunspecTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
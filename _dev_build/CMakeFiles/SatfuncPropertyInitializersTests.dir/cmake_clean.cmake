@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SatfuncPropertyInitializersTests.dir/tests/parser/SatfuncPropertyInitializersTests.cpp.o"
+  "CMakeFiles/SatfuncPropertyInitializersTests.dir/tests/parser/SatfuncPropertyInitializersTests.cpp.o.d"
+  "bin/SatfuncPropertyInitializersTests"
+  "bin/SatfuncPropertyInitializersTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SatfuncPropertyInitializersTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ScheduleCreateFromDeck.dir/tests/parser/integration/ScheduleCreateFromDeck.cpp.o"
+  "CMakeFiles/ScheduleCreateFromDeck.dir/tests/parser/integration/ScheduleCreateFromDeck.cpp.o.d"
+  "bin/ScheduleCreateFromDeck"
+  "bin/ScheduleCreateFromDeck.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ScheduleCreateFromDeck.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
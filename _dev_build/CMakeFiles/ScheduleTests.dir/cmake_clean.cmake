@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ScheduleTests.dir/tests/parser/ScheduleTests.cpp.o"
+  "CMakeFiles/ScheduleTests.dir/tests/parser/ScheduleTests.cpp.o.d"
+  "bin/ScheduleTests"
+  "bin/ScheduleTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ScheduleTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
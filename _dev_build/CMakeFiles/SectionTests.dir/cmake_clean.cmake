@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SectionTests.dir/tests/parser/SectionTests.cpp.o"
+  "CMakeFiles/SectionTests.dir/tests/parser/SectionTests.cpp.o.d"
+  "bin/SectionTests"
+  "bin/SectionTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SectionTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
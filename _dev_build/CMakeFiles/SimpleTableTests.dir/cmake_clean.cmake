@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SimpleTableTests.dir/tests/parser/SimpleTableTests.cpp.o"
+  "CMakeFiles/SimpleTableTests.dir/tests/parser/SimpleTableTests.cpp.o.d"
+  "bin/SimpleTableTests"
+  "bin/SimpleTableTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SimpleTableTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SimulationConfigTest.dir/tests/parser/SimulationConfigTest.cpp.o"
+  "CMakeFiles/SimulationConfigTest.dir/tests/parser/SimulationConfigTest.cpp.o.d"
+  "bin/SimulationConfigTest"
+  "bin/SimulationConfigTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SimulationConfigTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
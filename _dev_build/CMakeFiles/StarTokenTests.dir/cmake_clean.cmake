@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StarTokenTests.dir/tests/parser/StarTokenTests.cpp.o"
+  "CMakeFiles/StarTokenTests.dir/tests/parser/StarTokenTests.cpp.o.d"
+  "bin/StarTokenTests"
+  "bin/StarTokenTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StarTokenTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StringTests.dir/tests/parser/StringTests.cpp.o"
+  "CMakeFiles/StringTests.dir/tests/parser/StringTests.cpp.o.d"
+  "bin/StringTests"
+  "bin/StringTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StringTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
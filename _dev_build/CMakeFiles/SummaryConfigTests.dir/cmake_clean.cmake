@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SummaryConfigTests.dir/tests/parser/SummaryConfigTests.cpp.o"
+  "CMakeFiles/SummaryConfigTests.dir/tests/parser/SummaryConfigTests.cpp.o.d"
+  "bin/SummaryConfigTests"
+  "bin/SummaryConfigTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SummaryConfigTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
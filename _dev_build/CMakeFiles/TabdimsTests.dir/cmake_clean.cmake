@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TabdimsTests.dir/tests/parser/TabdimsTests.cpp.o"
+  "CMakeFiles/TabdimsTests.dir/tests/parser/TabdimsTests.cpp.o.d"
+  "bin/TabdimsTests"
+  "bin/TabdimsTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TabdimsTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
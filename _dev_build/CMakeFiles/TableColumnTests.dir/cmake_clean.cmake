@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TableColumnTests.dir/tests/parser/TableColumnTests.cpp.o"
+  "CMakeFiles/TableColumnTests.dir/tests/parser/TableColumnTests.cpp.o.d"
+  "bin/TableColumnTests"
+  "bin/TableColumnTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TableColumnTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TableContainerTests.dir/tests/parser/TableContainerTests.cpp.o"
+  "CMakeFiles/TableContainerTests.dir/tests/parser/TableContainerTests.cpp.o.d"
+  "bin/TableContainerTests"
+  "bin/TableContainerTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TableContainerTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TableManagerTests.dir/tests/parser/TableManagerTests.cpp.o"
+  "CMakeFiles/TableManagerTests.dir/tests/parser/TableManagerTests.cpp.o.d"
+  "bin/TableManagerTests"
+  "bin/TableManagerTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TableManagerTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TableSchemaTests.dir/tests/parser/TableSchemaTests.cpp.o"
+  "CMakeFiles/TableSchemaTests.dir/tests/parser/TableSchemaTests.cpp.o.d"
+  "bin/TableSchemaTests"
+  "bin/TableSchemaTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TableSchemaTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
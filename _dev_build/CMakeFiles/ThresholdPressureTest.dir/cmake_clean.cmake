@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ThresholdPressureTest.dir/tests/parser/ThresholdPressureTest.cpp.o"
+  "CMakeFiles/ThresholdPressureTest.dir/tests/parser/ThresholdPressureTest.cpp.o.d"
+  "bin/ThresholdPressureTest"
+  "bin/ThresholdPressureTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ThresholdPressureTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
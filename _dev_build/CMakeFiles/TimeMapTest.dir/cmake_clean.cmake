@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TimeMapTest.dir/tests/parser/TimeMapTest.cpp.o"
+  "CMakeFiles/TimeMapTest.dir/tests/parser/TimeMapTest.cpp.o.d"
+  "bin/TimeMapTest"
+  "bin/TimeMapTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TimeMapTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TransMultIntegrationTests.dir/tests/parser/integration/TransMultIntegrationTests.cpp.o"
+  "CMakeFiles/TransMultIntegrationTests.dir/tests/parser/integration/TransMultIntegrationTests.cpp.o.d"
+  "bin/TransMultIntegrationTests"
+  "bin/TransMultIntegrationTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TransMultIntegrationTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TransMultTests.dir/tests/parser/TransMultTests.cpp.o"
+  "CMakeFiles/TransMultTests.dir/tests/parser/TransMultTests.cpp.o.d"
+  "bin/TransMultTests"
+  "bin/TransMultTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TransMultTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TuningTests.dir/tests/parser/TuningTests.cpp.o"
+  "CMakeFiles/TuningTests.dir/tests/parser/TuningTests.cpp.o.d"
+  "bin/TuningTests"
+  "bin/TuningTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TuningTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
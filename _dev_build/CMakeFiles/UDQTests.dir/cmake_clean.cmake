@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/UDQTests.dir/tests/parser/UDQTests.cpp.o"
+  "CMakeFiles/UDQTests.dir/tests/parser/UDQTests.cpp.o.d"
+  "bin/UDQTests"
+  "bin/UDQTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UDQTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/UnitTests.dir/tests/parser/UnitTests.cpp.o"
+  "CMakeFiles/UnitTests.dir/tests/parser/UnitTests.cpp.o.d"
+  "bin/UnitTests"
+  "bin/UnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
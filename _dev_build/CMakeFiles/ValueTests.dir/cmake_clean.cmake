@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ValueTests.dir/tests/parser/ValueTests.cpp.o"
+  "CMakeFiles/ValueTests.dir/tests/parser/ValueTests.cpp.o.d"
+  "bin/ValueTests"
+  "bin/ValueTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ValueTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
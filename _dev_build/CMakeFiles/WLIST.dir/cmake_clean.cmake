@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/WLIST.dir/tests/parser/WLIST.cpp.o"
+  "CMakeFiles/WLIST.dir/tests/parser/WLIST.cpp.o.d"
+  "bin/WLIST"
+  "bin/WLIST.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/WLIST.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/WTEST.dir/tests/parser/WTEST.cpp.o"
+  "CMakeFiles/WTEST.dir/tests/parser/WTEST.cpp.o.d"
+  "bin/WTEST"
+  "bin/WTEST.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/WTEST.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/WellSolventTests.dir/tests/parser/WellSolventTests.cpp.o"
+  "CMakeFiles/WellSolventTests.dir/tests/parser/WellSolventTests.cpp.o.d"
+  "bin/WellSolventTests"
+  "bin/WellSolventTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/WellSolventTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/WellTests.dir/tests/parser/WellTests.cpp.o"
+  "CMakeFiles/WellTests.dir/tests/parser/WellTests.cpp.o.d"
+  "bin/WellTests"
+  "bin/WellTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/WellTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/WellTracerTests.dir/tests/parser/WellTracerTests.cpp.o"
+  "CMakeFiles/WellTracerTests.dir/tests/parser/WellTracerTests.cpp.o.d"
+  "bin/WellTracerTests"
+  "bin/WellTracerTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/WellTracerTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
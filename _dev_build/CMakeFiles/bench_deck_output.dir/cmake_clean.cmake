@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_deck_output.dir/benchmarks/bench_deck_output.cpp.o"
+  "CMakeFiles/bench_deck_output.dir/benchmarks/bench_deck_output.cpp.o.d"
+  "bin/bench_deck_output"
+  "bin/bench_deck_output.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_deck_output.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_parser.dir/benchmarks/bench_parser.cpp.o"
+  "CMakeFiles/bench_parser.dir/benchmarks/bench_parser.cpp.o.d"
+  "bin/bench_parser"
+  "bin/bench_parser.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_parser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
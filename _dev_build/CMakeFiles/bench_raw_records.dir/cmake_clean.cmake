@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_raw_records.dir/benchmarks/bench_raw_records.cpp.o"
+  "CMakeFiles/bench_raw_records.dir/benchmarks/bench_raw_records.cpp.o.d"
+  "bin/bench_raw_records"
+  "bin/bench_raw_records.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_raw_records.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
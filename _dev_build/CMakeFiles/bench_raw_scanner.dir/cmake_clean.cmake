@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_raw_scanner.dir/benchmarks/bench_raw_scanner.cpp.o"
+  "CMakeFiles/bench_raw_scanner.dir/benchmarks/bench_raw_scanner.cpp.o.d"
+  "bin/bench_raw_scanner"
+  "bin/bench_raw_scanner.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_raw_scanner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_star_token.dir/benchmarks/bench_star_token.cpp.o"
+  "CMakeFiles/bench_star_token.dir/benchmarks/bench_star_token.cpp.o.d"
+  "bin/bench_star_token"
+  "bin/bench_star_token.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench_star_token.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
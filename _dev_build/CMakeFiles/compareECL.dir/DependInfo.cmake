@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test_util/EclFilesComparator.cpp" "CMakeFiles/compareECL.dir/test_util/EclFilesComparator.cpp.o" "gcc" "CMakeFiles/compareECL.dir/test_util/EclFilesComparator.cpp.o.d"
+  "/root/repo/test_util/EclRegressionTest.cpp" "CMakeFiles/compareECL.dir/test_util/EclRegressionTest.cpp.o" "gcc" "CMakeFiles/compareECL.dir/test_util/EclRegressionTest.cpp.o.d"
+  "/root/repo/test_util/compareECL.cpp" "CMakeFiles/compareECL.dir/test_util/compareECL.cpp.o" "gcc" "CMakeFiles/compareECL.dir/test_util/compareECL.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dev_build/CMakeFiles/opmcommon.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/compareECL.dir/test_util/EclFilesComparator.cpp.o"
+  "CMakeFiles/compareECL.dir/test_util/EclFilesComparator.cpp.o.d"
+  "CMakeFiles/compareECL.dir/test_util/EclRegressionTest.cpp.o"
+  "CMakeFiles/compareECL.dir/test_util/EclRegressionTest.cpp.o.d"
+  "CMakeFiles/compareECL.dir/test_util/compareECL.cpp.o"
+  "CMakeFiles/compareECL.dir/test_util/compareECL.cpp.o.d"
+  "bin/compareECL"
+  "bin/compareECL.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/compareECL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
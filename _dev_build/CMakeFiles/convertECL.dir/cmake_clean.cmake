@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/convertECL.dir/test_util/convertECL.cpp.o"
+  "CMakeFiles/convertECL.dir/test_util/convertECL.cpp.o.d"
+  "bin/convertECL"
+  "bin/convertECL.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/convertECL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
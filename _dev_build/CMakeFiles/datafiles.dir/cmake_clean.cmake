@@ -0,0 +1,44 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/datafiles"
+  "tests/ECLFILE.FINIT"
+  "tests/ECLFILE.INIT"
+  "tests/FIRST_SIM.DATA"
+  "tests/FIRST_SIM_THPRES.DATA"
+  "tests/SOFR_TEST.DATA"
+  "tests/SPE1CASE1.DATA"
+  "tests/SPE1CASE1.EGRID"
+  "tests/SPE1CASE1.RFT"
+  "tests/SPE1CASE1.SMSPEC"
+  "tests/SPE1CASE1.UNSMRY"
+  "tests/SPE1CASE1A.SMSPEC"
+  "tests/SPE1CASE1A.UNSMRY"
+  "tests/SPE1CASE1_RST60.SMSPEC"
+  "tests/SPE1CASE1_RST60.UNSMRY"
+  "tests/SPE1_TESTCASE.F0025"
+  "tests/SPE1_TESTCASE.FUNRST"
+  "tests/SPE1_TESTCASE.UNRST"
+  "tests/SPE1_TESTCASE.X0025"
+  "tests/SPE9_CP_PACKED.DATA"
+  "tests/SUMMARY_EFF_FAC.DATA"
+  "tests/UDQ_ACTIONX_TEST1.DATA"
+  "tests/UDQ_TEST_WCONPROD_IUAD-2.DATA"
+  "tests/expect-wdims.chldg.err.out"
+  "tests/expect-wdims.err.out"
+  "tests/group_group.DATA"
+  "tests/include_example_pvt.txt"
+  "tests/include_example_summary.txt"
+  "tests/include_grid_3x5x4.grdecl"
+  "tests/include_sgof.txt"
+  "tests/include_swof.txt"
+  "tests/summary_deck.DATA"
+  "tests/summary_deck_non_constant_porosity.DATA"
+  "tests/table_deck.DATA"
+  "tests/testblackoilstate3.DATA"
+  "tests/testdata.param"
+  "tests/testrft.DATA"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/datafiles.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/deckgenerator.dir/benchmarks/DeckGenerator.cpp.o"
+  "CMakeFiles/deckgenerator.dir/benchmarks/DeckGenerator.cpp.o.d"
+  "lib/libdeckgenerator.a"
+  "lib/libdeckgenerator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/deckgenerator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
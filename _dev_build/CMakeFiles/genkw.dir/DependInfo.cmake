@@ -0,0 +1,47 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/external/cjson/cJSON.c" "CMakeFiles/genkw.dir/external/cjson/cJSON.c.o" "gcc" "CMakeFiles/genkw.dir/external/cjson/cJSON.c.o.d"
+  "/root/repo/src/opm/common/OpmLog/LogBackend.cpp" "CMakeFiles/genkw.dir/src/opm/common/OpmLog/LogBackend.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/common/OpmLog/LogBackend.cpp.o.d"
+  "/root/repo/src/opm/common/OpmLog/LogUtil.cpp" "CMakeFiles/genkw.dir/src/opm/common/OpmLog/LogUtil.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/common/OpmLog/LogUtil.cpp.o.d"
+  "/root/repo/src/opm/common/OpmLog/Logger.cpp" "CMakeFiles/genkw.dir/src/opm/common/OpmLog/Logger.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/common/OpmLog/Logger.cpp.o.d"
+  "/root/repo/src/opm/common/OpmLog/OpmLog.cpp" "CMakeFiles/genkw.dir/src/opm/common/OpmLog/OpmLog.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/common/OpmLog/OpmLog.cpp.o.d"
+  "/root/repo/src/opm/common/OpmLog/StreamLog.cpp" "CMakeFiles/genkw.dir/src/opm/common/OpmLog/StreamLog.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/common/OpmLog/StreamLog.cpp.o.d"
+  "/root/repo/src/opm/json/JsonObject.cpp" "CMakeFiles/genkw.dir/src/opm/json/JsonObject.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/json/JsonObject.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Deck/Deck.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/Deck.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/Deck.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Deck/DeckItem.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckItem.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckItem.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Deck/DeckKeyword.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckKeyword.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckKeyword.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Deck/DeckOutput.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckOutput.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckOutput.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Deck/DeckRecord.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckRecord.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckRecord.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Deck/DeckValue.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckValue.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckValue.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Deck/UDAValue.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/UDAValue.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/UDAValue.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Generator/KeywordGenerator.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Generator/KeywordGenerator.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Generator/KeywordGenerator.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Generator/KeywordLoader.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Generator/KeywordLoader.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Generator/KeywordLoader.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/ErrorGuard.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ErrorGuard.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ErrorGuard.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/ParseContext.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParseContext.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParseContext.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/ParserEnums.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParserEnums.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParserEnums.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/ParserItem.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParserItem.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParserItem.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/ParserKeyword.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParserKeyword.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParserKeyword.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/ParserRecord.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParserRecord.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParserRecord.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/createDefaultKeywordList.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/createDefaultKeywordList.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/createDefaultKeywordList.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/raw/RawKeyword.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/raw/RawKeyword.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/raw/RawKeyword.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/raw/RawRecord.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/raw/RawRecord.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/raw/RawRecord.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/raw/StarToken.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/raw/StarToken.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/raw/StarToken.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Units/Dimension.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Units/Dimension.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Units/Dimension.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Units/UnitSystem.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Units/UnitSystem.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Units/UnitSystem.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Utility/Stringview.cpp" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Utility/Stringview.cpp.o" "gcc" "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Utility/Stringview.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
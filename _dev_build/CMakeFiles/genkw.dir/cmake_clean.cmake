@@ -0,0 +1,67 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/genkw.dir/external/cjson/cJSON.c.o"
+  "CMakeFiles/genkw.dir/external/cjson/cJSON.c.o.d"
+  "CMakeFiles/genkw.dir/src/opm/common/OpmLog/LogBackend.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/common/OpmLog/LogBackend.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/common/OpmLog/LogUtil.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/common/OpmLog/LogUtil.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/common/OpmLog/Logger.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/common/OpmLog/Logger.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/common/OpmLog/OpmLog.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/common/OpmLog/OpmLog.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/common/OpmLog/StreamLog.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/common/OpmLog/StreamLog.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/json/JsonObject.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/json/JsonObject.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/Deck.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/Deck.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckItem.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckItem.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckKeyword.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckKeyword.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckOutput.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckOutput.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckRecord.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckRecord.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckValue.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/DeckValue.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/UDAValue.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Deck/UDAValue.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Generator/KeywordGenerator.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Generator/KeywordGenerator.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Generator/KeywordLoader.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Generator/KeywordLoader.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ErrorGuard.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ErrorGuard.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParseContext.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParseContext.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParserEnums.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParserEnums.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParserItem.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParserItem.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParserKeyword.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParserKeyword.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParserRecord.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/ParserRecord.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/createDefaultKeywordList.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/createDefaultKeywordList.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/raw/RawKeyword.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/raw/RawKeyword.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/raw/RawRecord.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/raw/RawRecord.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/raw/StarToken.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Parser/raw/StarToken.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Units/Dimension.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Units/Dimension.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Units/UnitSystem.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Units/UnitSystem.cpp.o.d"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Utility/Stringview.cpp.o"
+  "CMakeFiles/genkw.dir/src/opm/parser/eclipse/Utility/Stringview.cpp.o.d"
+  "bin/genkw"
+  "bin/genkw.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/genkw.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
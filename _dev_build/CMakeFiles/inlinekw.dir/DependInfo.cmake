@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_dev_build/inlinekw.cpp" "CMakeFiles/inlinekw.dir/inlinekw.cpp.o" "gcc" "CMakeFiles/inlinekw.dir/inlinekw.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_dev_build/inlinekw.cpp" "/root/repo/_dev_build/ParserKeywords.cpp"
+  "/root/repo/_dev_build/tmp_gen/inlinekw.cpp" "/root/repo/_dev_build/tmp_gen/ParserKeywords.cpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dev_build/CMakeFiles/opmcommon.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/inlinekw.dir/inlinekw.cpp.o"
+  "CMakeFiles/inlinekw.dir/inlinekw.cpp.o.d"
+  "ParserKeywords.cpp"
+  "bin/inlinekw"
+  "bin/inlinekw.pdb"
+  "inlinekw.cpp"
+  "tmp_gen/ParserKeywords.cpp"
+  "tmp_gen/inlinekw.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/inlinekw.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/jsonTests.dir/tests/json/jsonTests.cpp.o"
+  "CMakeFiles/jsonTests.dir/tests/json/jsonTests.cpp.o.d"
+  "bin/jsonTests"
+  "bin/jsonTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/jsonTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,210 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/external/cjson/cJSON.c" "CMakeFiles/opmcommon.dir/external/cjson/cJSON.c.o" "gcc" "CMakeFiles/opmcommon.dir/external/cjson/cJSON.c.o.d"
+  "/root/repo/_dev_build/ParserKeywords.cpp" "CMakeFiles/opmcommon.dir/ParserKeywords.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/ParserKeywords.cpp.o.d"
+  "/root/repo/src/opm/common/OpmLog/AsyncLogBackend.cpp" "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/AsyncLogBackend.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/AsyncLogBackend.cpp.o.d"
+  "/root/repo/src/opm/common/OpmLog/CounterLog.cpp" "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/CounterLog.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/CounterLog.cpp.o.d"
+  "/root/repo/src/opm/common/OpmLog/EclipsePRTLog.cpp" "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/EclipsePRTLog.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/EclipsePRTLog.cpp.o.d"
+  "/root/repo/src/opm/common/OpmLog/LogBackend.cpp" "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/LogBackend.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/LogBackend.cpp.o.d"
+  "/root/repo/src/opm/common/OpmLog/LogUtil.cpp" "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/LogUtil.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/LogUtil.cpp.o.d"
+  "/root/repo/src/opm/common/OpmLog/Logger.cpp" "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/Logger.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/Logger.cpp.o.d"
+  "/root/repo/src/opm/common/OpmLog/OpmLog.cpp" "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/OpmLog.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/OpmLog.cpp.o.d"
+  "/root/repo/src/opm/common/OpmLog/StreamLog.cpp" "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/StreamLog.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/StreamLog.cpp.o.d"
+  "/root/repo/src/opm/common/OpmLog/TimerLog.cpp" "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/TimerLog.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/TimerLog.cpp.o.d"
+  "/root/repo/src/opm/common/data/SimulationDataContainer.cpp" "CMakeFiles/opmcommon.dir/src/opm/common/data/SimulationDataContainer.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/common/data/SimulationDataContainer.cpp.o.d"
+  "/root/repo/src/opm/common/utility/TimeService.cpp" "CMakeFiles/opmcommon.dir/src/opm/common/utility/TimeService.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/common/utility/TimeService.cpp.o.d"
+  "/root/repo/src/opm/common/utility/numeric/MonotCubicInterpolator.cpp" "CMakeFiles/opmcommon.dir/src/opm/common/utility/numeric/MonotCubicInterpolator.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/common/utility/numeric/MonotCubicInterpolator.cpp.o.d"
+  "/root/repo/src/opm/common/utility/numeric/calculateCellVol.cpp" "CMakeFiles/opmcommon.dir/src/opm/common/utility/numeric/calculateCellVol.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/common/utility/numeric/calculateCellVol.cpp.o.d"
+  "/root/repo/src/opm/common/utility/parameters/Parameter.cpp" "CMakeFiles/opmcommon.dir/src/opm/common/utility/parameters/Parameter.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/common/utility/parameters/Parameter.cpp.o.d"
+  "/root/repo/src/opm/common/utility/parameters/ParameterGroup.cpp" "CMakeFiles/opmcommon.dir/src/opm/common/utility/parameters/ParameterGroup.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/common/utility/parameters/ParameterGroup.cpp.o.d"
+  "/root/repo/src/opm/common/utility/parameters/ParameterTools.cpp" "CMakeFiles/opmcommon.dir/src/opm/common/utility/parameters/ParameterTools.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/common/utility/parameters/ParameterTools.cpp.o.d"
+  "/root/repo/src/opm/io/eclipse/EGrid.cpp" "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/EGrid.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/EGrid.cpp.o.d"
+  "/root/repo/src/opm/io/eclipse/ERft.cpp" "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/ERft.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/ERft.cpp.o.d"
+  "/root/repo/src/opm/io/eclipse/ERst.cpp" "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/ERst.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/ERst.cpp.o.d"
+  "/root/repo/src/opm/io/eclipse/ESmry.cpp" "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/ESmry.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/ESmry.cpp.o.d"
+  "/root/repo/src/opm/io/eclipse/EclFile.cpp" "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/EclFile.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/EclFile.cpp.o.d"
+  "/root/repo/src/opm/io/eclipse/EclOutput.cpp" "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/EclOutput.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/EclOutput.cpp.o.d"
+  "/root/repo/src/opm/io/eclipse/EclUtil.cpp" "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/EclUtil.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/EclUtil.cpp.o.d"
+  "/root/repo/src/opm/io/eclipse/OutputStream.cpp" "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/OutputStream.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/OutputStream.cpp.o.d"
+  "/root/repo/src/opm/json/JsonObject.cpp" "CMakeFiles/opmcommon.dir/src/opm/json/JsonObject.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/json/JsonObject.cpp.o.d"
+  "/root/repo/src/opm/output/data/Solution.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/data/Solution.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/data/Solution.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/AggregateActionxData.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateActionxData.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateActionxData.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/AggregateConnectionData.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateConnectionData.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateConnectionData.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/AggregateGroupData.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateGroupData.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateGroupData.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/AggregateMSWData.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateMSWData.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateMSWData.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/AggregateUDQData.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateUDQData.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateUDQData.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/AggregateWellData.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateWellData.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateWellData.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/CreateActionxDims.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateActionxDims.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateActionxDims.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/CreateDoubHead.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateDoubHead.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateDoubHead.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/CreateInteHead.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateInteHead.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateInteHead.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/CreateLogiHead.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateLogiHead.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateLogiHead.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/CreateUdqDims.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateUdqDims.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateUdqDims.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/DoubHEAD.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/DoubHEAD.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/DoubHEAD.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/EclipseGridInspector.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/EclipseGridInspector.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/EclipseGridInspector.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/EclipseIO.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/EclipseIO.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/EclipseIO.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/InteHEAD.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/InteHEAD.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/InteHEAD.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/LinearisedOutputTable.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/LinearisedOutputTable.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/LinearisedOutputTable.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/LoadRestart.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/LoadRestart.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/LoadRestart.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/LogiHEAD.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/LogiHEAD.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/LogiHEAD.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/RegionCache.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/RegionCache.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/RegionCache.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/RestartIO.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/RestartIO.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/RestartIO.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/RestartValue.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/RestartValue.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/RestartValue.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/Summary.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/Summary.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/Summary.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/Tables.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/Tables.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/Tables.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/WriteInit.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/WriteInit.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/WriteInit.cpp.o.d"
+  "/root/repo/src/opm/output/eclipse/WriteRFT.cpp" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/WriteRFT.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/WriteRFT.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Deck/Deck.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/Deck.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/Deck.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Deck/DeckItem.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckItem.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckItem.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Deck/DeckKeyword.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckKeyword.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckKeyword.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Deck/DeckOutput.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckOutput.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckOutput.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Deck/DeckRecord.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckRecord.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckRecord.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Deck/DeckValue.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckValue.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckValue.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Deck/Section.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/Section.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/Section.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Deck/UDAValue.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/UDAValue.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/UDAValue.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Aquancon.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Aquancon.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Aquancon.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/AquiferCT.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/AquiferCT.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/AquiferCT.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Aquifetp.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Aquifetp.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Aquifetp.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Eclipse3DProperties.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Eclipse3DProperties.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Eclipse3DProperties.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/EclipseConfig.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/EclipseConfig.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/EclipseConfig.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/EclipseState.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/EclipseState.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/EclipseState.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Edit/EDITNNC.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Edit/EDITNNC.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Edit/EDITNNC.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/EndpointScaling.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/EndpointScaling.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/EndpointScaling.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Grid/Box.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/Box.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/Box.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Grid/BoxManager.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/BoxManager.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/BoxManager.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Grid/EclipseGrid.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/EclipseGrid.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/EclipseGrid.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Grid/FaceDir.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/FaceDir.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/FaceDir.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Grid/Fault.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/Fault.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/Fault.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Grid/FaultCollection.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/FaultCollection.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/FaultCollection.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Grid/FaultFace.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/FaultFace.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/FaultFace.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Grid/GridDims.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/GridDims.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/GridDims.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Grid/GridProperties.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/GridProperties.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/GridProperties.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Grid/GridProperty.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/GridProperty.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/GridProperty.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Grid/MULTREGTScanner.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/MULTREGTScanner.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/MULTREGTScanner.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Grid/NNC.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/NNC.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/NNC.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Grid/Operate.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/Operate.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/Operate.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Grid/PinchMode.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/PinchMode.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/PinchMode.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Grid/SatfuncPropertyInitializers.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/SatfuncPropertyInitializers.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/SatfuncPropertyInitializers.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Grid/TransMult.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/TransMult.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/TransMult.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Grid/setKeywordBox.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/setKeywordBox.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/setKeywordBox.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/IOConfig/IOConfig.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/IOConfig/IOConfig.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/IOConfig/IOConfig.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/IOConfig/RestartConfig.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/IOConfig/RestartConfig.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/IOConfig/RestartConfig.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/InitConfig/Equil.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/InitConfig/Equil.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/InitConfig/Equil.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/InitConfig/FoamConfig.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/InitConfig/FoamConfig.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/InitConfig/FoamConfig.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/InitConfig/InitConfig.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/InitConfig/InitConfig.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/InitConfig/InitConfig.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Runspec.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Runspec.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Runspec.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Action/ASTNode.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ASTNode.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ASTNode.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Action/Actdims.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/Actdims.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/Actdims.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionAST.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionAST.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionAST.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionContext.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionContext.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionContext.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionParser.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionParser.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionParser.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionResult.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionResult.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionResult.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionValue.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionValue.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionValue.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionX.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionX.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionX.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Action/Actions.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/Actions.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/Actions.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Action/Condition.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/Condition.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/Condition.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/ArrayDimChecker.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/ArrayDimChecker.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/ArrayDimChecker.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Events.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Events.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Events.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Group/GTNode.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/GTNode.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/GTNode.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Group/Group2.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/Group2.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/Group2.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Group/GuideRate.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/GuideRate.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/GuideRate.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Group/GuideRateConfig.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/GuideRateConfig.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/GuideRateConfig.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Group/GuideRateModel.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/GuideRateModel.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/GuideRateModel.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/MSW/Compsegs.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MSW/Compsegs.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MSW/Compsegs.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/MSW/Segment.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MSW/Segment.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MSW/Segment.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/MSW/WellSegments.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MSW/WellSegments.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MSW/WellSegments.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/MSW/updatingConnectionsWithSegments.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MSW/updatingConnectionsWithSegments.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MSW/updatingConnectionsWithSegments.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/MessageLimits.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MessageLimits.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MessageLimits.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/OilVaporizationProperties.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/OilVaporizationProperties.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/OilVaporizationProperties.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/RFTConfig.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/RFTConfig.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/RFTConfig.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Schedule.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Schedule.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Schedule.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/SummaryState.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/SummaryState.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/SummaryState.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/TimeMap.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/TimeMap.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/TimeMap.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Tuning.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Tuning.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Tuning.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQASTNode.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQASTNode.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQASTNode.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQActive.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQActive.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQActive.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQAssign.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQAssign.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQAssign.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQConfig.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQConfig.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQConfig.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQContext.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQContext.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQContext.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQDefine.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQDefine.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQDefine.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQEnums.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQEnums.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQEnums.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunction.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunction.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunction.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunctionTable.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunctionTable.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunctionTable.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQInput.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQInput.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQInput.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQParams.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQParams.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQParams.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQParser.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQParser.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQParser.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQSet.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQSet.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQSet.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/VFPInjTable.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/VFPInjTable.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/VFPInjTable.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/VFPProdTable.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/VFPProdTable.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/VFPProdTable.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Well/Connection.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/Connection.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/Connection.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Well/WList.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WList.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WList.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Well/WListManager.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WListManager.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WListManager.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Well/Well2.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/Well2.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/Well2.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellConnections.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellConnections.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellConnections.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellEconProductionLimits.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellEconProductionLimits.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellEconProductionLimits.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellFoamProperties.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellFoamProperties.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellFoamProperties.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellInjectionProperties.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellInjectionProperties.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellInjectionProperties.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellPolymerProperties.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellPolymerProperties.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellPolymerProperties.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellProductionProperties.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellProductionProperties.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellProductionProperties.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellTestConfig.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellTestConfig.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellTestConfig.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellTestState.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellTestState.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellTestState.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellTracerProperties.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellTracerProperties.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellTracerProperties.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/Well/injection.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/injection.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/injection.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Schedule/eval_uda.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/eval_uda.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/eval_uda.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/SimulationConfig/SimulationConfig.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/SimulationConfig/SimulationConfig.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/SimulationConfig/SimulationConfig.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/SimulationConfig/ThresholdPressure.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/SimulationConfig/ThresholdPressure.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/SimulationConfig/ThresholdPressure.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/SummaryConfig/SummaryConfig.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/SummaryConfig/SummaryConfig.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/SummaryConfig/SummaryConfig.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Tables/ColumnSchema.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/ColumnSchema.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/ColumnSchema.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Tables/JFunc.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/JFunc.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/JFunc.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Tables/PolyInjTables.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/PolyInjTables.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/PolyInjTables.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Tables/PvtxTable.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/PvtxTable.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/PvtxTable.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Tables/Rock2dTable.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/Rock2dTable.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/Rock2dTable.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Tables/Rock2dtrTable.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/Rock2dtrTable.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/Rock2dtrTable.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Tables/SimpleTable.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/SimpleTable.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/SimpleTable.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Tables/TableColumn.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableColumn.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableColumn.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Tables/TableContainer.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableContainer.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableContainer.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Tables/TableIndex.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableIndex.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableIndex.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Tables/TableManager.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableManager.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableManager.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Tables/TableSchema.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableSchema.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableSchema.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/Tables/Tables.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/Tables.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/Tables.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/EclipseState/checkDeck.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/checkDeck.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/checkDeck.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/BuiltinKeywords.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/BuiltinKeywords.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/BuiltinKeywords.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/DeckCache.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/DeckCache.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/DeckCache.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/ErrorGuard.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ErrorGuard.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ErrorGuard.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/ParseContext.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParseContext.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParseContext.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/ParseProfile.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParseProfile.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParseProfile.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/Parser.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/Parser.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/Parser.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/ParserEnums.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParserEnums.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParserEnums.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/ParserItem.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParserItem.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParserItem.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/ParserKeyword.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParserKeyword.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParserKeyword.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/ParserRecord.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParserRecord.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParserRecord.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/raw/RawKeyword.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/raw/RawKeyword.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/raw/RawKeyword.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/raw/RawRecord.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/raw/RawRecord.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/raw/RawRecord.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Parser/raw/StarToken.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/raw/StarToken.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/raw/StarToken.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Python/Python.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Python/Python.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Python/Python.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Units/Dimension.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Units/Dimension.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Units/Dimension.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Units/UnitSystem.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Units/UnitSystem.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Units/UnitSystem.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Utility/Functional.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Utility/Functional.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Utility/Functional.cpp.o.d"
+  "/root/repo/src/opm/parser/eclipse/Utility/Stringview.cpp" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Utility/Stringview.cpp.o" "gcc" "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Utility/Stringview.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_dev_build/inlinekw.cpp" "/root/repo/_dev_build/ParserKeywords.cpp"
+  "/root/repo/_dev_build/tmp_gen/inlinekw.cpp" "/root/repo/_dev_build/tmp_gen/ParserKeywords.cpp"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
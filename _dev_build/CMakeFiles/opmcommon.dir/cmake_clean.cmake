@@ -0,0 +1,383 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/opmcommon.dir/ParserKeywords.cpp.o"
+  "CMakeFiles/opmcommon.dir/ParserKeywords.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/external/cjson/cJSON.c.o"
+  "CMakeFiles/opmcommon.dir/external/cjson/cJSON.c.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/AsyncLogBackend.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/AsyncLogBackend.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/CounterLog.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/CounterLog.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/EclipsePRTLog.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/EclipsePRTLog.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/LogBackend.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/LogBackend.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/LogUtil.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/LogUtil.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/Logger.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/Logger.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/OpmLog.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/OpmLog.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/StreamLog.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/StreamLog.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/TimerLog.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/common/OpmLog/TimerLog.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/common/data/SimulationDataContainer.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/common/data/SimulationDataContainer.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/common/utility/TimeService.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/common/utility/TimeService.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/common/utility/numeric/MonotCubicInterpolator.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/common/utility/numeric/MonotCubicInterpolator.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/common/utility/numeric/calculateCellVol.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/common/utility/numeric/calculateCellVol.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/common/utility/parameters/Parameter.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/common/utility/parameters/Parameter.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/common/utility/parameters/ParameterGroup.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/common/utility/parameters/ParameterGroup.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/common/utility/parameters/ParameterTools.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/common/utility/parameters/ParameterTools.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/EGrid.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/EGrid.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/ERft.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/ERft.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/ERst.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/ERst.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/ESmry.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/ESmry.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/EclFile.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/EclFile.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/EclOutput.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/EclOutput.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/EclUtil.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/EclUtil.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/OutputStream.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/io/eclipse/OutputStream.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/json/JsonObject.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/json/JsonObject.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/data/Solution.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/data/Solution.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateActionxData.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateActionxData.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateConnectionData.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateConnectionData.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateGroupData.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateGroupData.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateMSWData.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateMSWData.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateUDQData.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateUDQData.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateWellData.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/AggregateWellData.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateActionxDims.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateActionxDims.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateDoubHead.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateDoubHead.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateInteHead.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateInteHead.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateLogiHead.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateLogiHead.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateUdqDims.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/CreateUdqDims.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/DoubHEAD.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/DoubHEAD.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/EclipseGridInspector.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/EclipseGridInspector.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/EclipseIO.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/EclipseIO.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/InteHEAD.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/InteHEAD.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/LinearisedOutputTable.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/LinearisedOutputTable.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/LoadRestart.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/LoadRestart.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/LogiHEAD.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/LogiHEAD.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/RegionCache.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/RegionCache.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/RestartIO.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/RestartIO.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/RestartValue.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/RestartValue.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/Summary.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/Summary.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/Tables.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/Tables.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/WriteInit.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/WriteInit.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/WriteRFT.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/output/eclipse/WriteRFT.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/Deck.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/Deck.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckItem.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckItem.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckKeyword.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckKeyword.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckOutput.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckOutput.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckRecord.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckRecord.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckValue.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/DeckValue.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/Section.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/Section.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/UDAValue.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Deck/UDAValue.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Aquancon.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Aquancon.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/AquiferCT.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/AquiferCT.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Aquifetp.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Aquifetp.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Eclipse3DProperties.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Eclipse3DProperties.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/EclipseConfig.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/EclipseConfig.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/EclipseState.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/EclipseState.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Edit/EDITNNC.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Edit/EDITNNC.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/EndpointScaling.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/EndpointScaling.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/Box.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/Box.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/BoxManager.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/BoxManager.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/EclipseGrid.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/EclipseGrid.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/FaceDir.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/FaceDir.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/Fault.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/Fault.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/FaultCollection.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/FaultCollection.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/FaultFace.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/FaultFace.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/GridDims.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/GridDims.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/GridProperties.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/GridProperties.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/GridProperty.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/GridProperty.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/MULTREGTScanner.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/MULTREGTScanner.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/NNC.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/NNC.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/Operate.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/Operate.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/PinchMode.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/PinchMode.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/SatfuncPropertyInitializers.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/SatfuncPropertyInitializers.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/TransMult.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/TransMult.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/setKeywordBox.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Grid/setKeywordBox.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/IOConfig/IOConfig.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/IOConfig/IOConfig.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/IOConfig/RestartConfig.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/IOConfig/RestartConfig.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/InitConfig/Equil.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/InitConfig/Equil.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/InitConfig/FoamConfig.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/InitConfig/FoamConfig.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/InitConfig/InitConfig.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/InitConfig/InitConfig.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Runspec.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Runspec.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ASTNode.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ASTNode.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/Actdims.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/Actdims.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionAST.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionAST.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionContext.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionContext.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionParser.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionParser.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionResult.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionResult.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionValue.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionValue.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionX.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/ActionX.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/Actions.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/Actions.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/Condition.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Action/Condition.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/ArrayDimChecker.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/ArrayDimChecker.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Events.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Events.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/GTNode.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/GTNode.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/Group2.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/Group2.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/GuideRate.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/GuideRate.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/GuideRateConfig.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/GuideRateConfig.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/GuideRateModel.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Group/GuideRateModel.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MSW/Compsegs.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MSW/Compsegs.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MSW/Segment.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MSW/Segment.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MSW/WellSegments.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MSW/WellSegments.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MSW/updatingConnectionsWithSegments.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MSW/updatingConnectionsWithSegments.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MessageLimits.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/MessageLimits.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/OilVaporizationProperties.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/OilVaporizationProperties.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/RFTConfig.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/RFTConfig.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Schedule.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Schedule.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/SummaryState.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/SummaryState.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/TimeMap.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/TimeMap.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Tuning.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Tuning.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQASTNode.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQASTNode.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQActive.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQActive.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQAssign.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQAssign.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQConfig.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQConfig.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQContext.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQContext.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQDefine.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQDefine.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQEnums.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQEnums.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunction.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunction.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunctionTable.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunctionTable.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQInput.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQInput.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQParams.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQParams.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQParser.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQParser.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQSet.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQSet.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/VFPInjTable.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/VFPInjTable.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/VFPProdTable.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/VFPProdTable.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/Connection.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/Connection.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WList.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WList.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WListManager.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WListManager.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/Well2.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/Well2.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellConnections.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellConnections.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellEconProductionLimits.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellEconProductionLimits.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellFoamProperties.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellFoamProperties.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellInjectionProperties.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellInjectionProperties.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellPolymerProperties.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellPolymerProperties.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellProductionProperties.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellProductionProperties.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellTestConfig.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellTestConfig.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellTestState.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellTestState.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellTracerProperties.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/WellTracerProperties.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/injection.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/Well/injection.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/eval_uda.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Schedule/eval_uda.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/SimulationConfig/SimulationConfig.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/SimulationConfig/SimulationConfig.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/SimulationConfig/ThresholdPressure.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/SimulationConfig/ThresholdPressure.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/SummaryConfig/SummaryConfig.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/SummaryConfig/SummaryConfig.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/ColumnSchema.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/ColumnSchema.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/JFunc.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/JFunc.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/PolyInjTables.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/PolyInjTables.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/PvtxTable.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/PvtxTable.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/Rock2dTable.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/Rock2dTable.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/Rock2dtrTable.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/Rock2dtrTable.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/SimpleTable.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/SimpleTable.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableColumn.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableColumn.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableContainer.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableContainer.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableIndex.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableIndex.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableManager.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableManager.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableSchema.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/TableSchema.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/Tables.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/Tables/Tables.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/checkDeck.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/EclipseState/checkDeck.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/BuiltinKeywords.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/BuiltinKeywords.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/DeckCache.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/DeckCache.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ErrorGuard.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ErrorGuard.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParseContext.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParseContext.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParseProfile.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParseProfile.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/Parser.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/Parser.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParserEnums.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParserEnums.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParserItem.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParserItem.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParserKeyword.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParserKeyword.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParserRecord.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/ParserRecord.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/raw/RawKeyword.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/raw/RawKeyword.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/raw/RawRecord.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/raw/RawRecord.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/raw/StarToken.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Parser/raw/StarToken.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Python/Python.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Python/Python.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Units/Dimension.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Units/Dimension.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Units/UnitSystem.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Units/UnitSystem.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Utility/Functional.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Utility/Functional.cpp.o.d"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Utility/Stringview.cpp.o"
+  "CMakeFiles/opmcommon.dir/src/opm/parser/eclipse/Utility/Stringview.cpp.o.d"
+  "ParserKeywords.cpp"
+  "inlinekw.cpp"
+  "lib/libopmcommon.a"
+  "lib/libopmcommon.pdb"
+  "tmp_gen/ParserKeywords.cpp"
+  "tmp_gen/inlinekw.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/opmcommon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/opmhash.dir/examples/opmhash.cpp.o"
+  "CMakeFiles/opmhash.dir/examples/opmhash.cpp.o.d"
+  "bin/opmhash"
+  "bin/opmhash.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opmhash.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
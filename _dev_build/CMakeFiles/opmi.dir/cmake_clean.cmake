@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/opmi.dir/examples/opmi.cpp.o"
+  "CMakeFiles/opmi.dir/examples/opmi.cpp.o.d"
+  "bin/opmi"
+  "bin/opmi.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opmi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
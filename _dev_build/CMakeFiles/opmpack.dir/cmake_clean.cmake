@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/opmpack.dir/examples/opmpack.cpp.o"
+  "CMakeFiles/opmpack.dir/examples/opmpack.cpp.o.d"
+  "bin/opmpack"
+  "bin/opmpack.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/opmpack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_AggregateActionxData.dir/tests/test_AggregateActionxData.cpp.o"
+  "CMakeFiles/test_AggregateActionxData.dir/tests/test_AggregateActionxData.cpp.o.d"
+  "bin/test_AggregateActionxData"
+  "bin/test_AggregateActionxData.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_AggregateActionxData.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_AggregateConnectionData.dir/tests/test_AggregateConnectionData.cpp.o"
+  "CMakeFiles/test_AggregateConnectionData.dir/tests/test_AggregateConnectionData.cpp.o.d"
+  "bin/test_AggregateConnectionData"
+  "bin/test_AggregateConnectionData.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_AggregateConnectionData.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_AggregateGroupData.dir/tests/test_AggregateGroupData.cpp.o"
+  "CMakeFiles/test_AggregateGroupData.dir/tests/test_AggregateGroupData.cpp.o.d"
+  "bin/test_AggregateGroupData"
+  "bin/test_AggregateGroupData.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_AggregateGroupData.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_AggregateMSWData.dir/tests/test_AggregateMSWData.cpp.o"
+  "CMakeFiles/test_AggregateMSWData.dir/tests/test_AggregateMSWData.cpp.o.d"
+  "bin/test_AggregateMSWData"
+  "bin/test_AggregateMSWData.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_AggregateMSWData.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_AggregateUDQData.dir/tests/test_AggregateUDQData.cpp.o"
+  "CMakeFiles/test_AggregateUDQData.dir/tests/test_AggregateUDQData.cpp.o.d"
+  "bin/test_AggregateUDQData"
+  "bin/test_AggregateUDQData.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_AggregateUDQData.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
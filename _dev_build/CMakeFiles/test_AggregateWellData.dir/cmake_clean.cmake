@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_AggregateWellData.dir/tests/test_AggregateWellData.cpp.o"
+  "CMakeFiles/test_AggregateWellData.dir/tests/test_AggregateWellData.cpp.o.d"
+  "bin/test_AggregateWellData"
+  "bin/test_AggregateWellData.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_AggregateWellData.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
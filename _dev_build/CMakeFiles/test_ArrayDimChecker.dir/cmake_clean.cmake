@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_ArrayDimChecker.dir/tests/test_ArrayDimChecker.cpp.o"
+  "CMakeFiles/test_ArrayDimChecker.dir/tests/test_ArrayDimChecker.cpp.o.d"
+  "bin/test_ArrayDimChecker"
+  "bin/test_ArrayDimChecker.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ArrayDimChecker.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_DoubHEAD.dir/tests/test_DoubHEAD.cpp.o"
+  "CMakeFiles/test_DoubHEAD.dir/tests/test_DoubHEAD.cpp.o.d"
+  "bin/test_DoubHEAD"
+  "bin/test_DoubHEAD.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_DoubHEAD.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_EGrid.dir/tests/test_EGrid.cpp.o"
+  "CMakeFiles/test_EGrid.dir/tests/test_EGrid.cpp.o.d"
+  "bin/test_EGrid"
+  "bin/test_EGrid.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_EGrid.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
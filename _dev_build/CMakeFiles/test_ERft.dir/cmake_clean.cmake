@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_ERft.dir/tests/test_ERft.cpp.o"
+  "CMakeFiles/test_ERft.dir/tests/test_ERft.cpp.o.d"
+  "bin/test_ERft"
+  "bin/test_ERft.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ERft.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_ERst.dir/tests/test_ERst.cpp.o"
+  "CMakeFiles/test_ERst.dir/tests/test_ERst.cpp.o.d"
+  "bin/test_ERst"
+  "bin/test_ERst.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ERst.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
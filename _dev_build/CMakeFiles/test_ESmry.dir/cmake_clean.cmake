@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_ESmry.dir/tests/test_ESmry.cpp.o"
+  "CMakeFiles/test_ESmry.dir/tests/test_ESmry.cpp.o.d"
+  "bin/test_ESmry"
+  "bin/test_ESmry.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ESmry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_EclFilesComparator.dir/test_util/EclFilesComparator.cpp.o"
+  "CMakeFiles/test_EclFilesComparator.dir/test_util/EclFilesComparator.cpp.o.d"
+  "CMakeFiles/test_EclFilesComparator.dir/tests/test_EclFilesComparator.cpp.o"
+  "CMakeFiles/test_EclFilesComparator.dir/tests/test_EclFilesComparator.cpp.o.d"
+  "bin/test_EclFilesComparator"
+  "bin/test_EclFilesComparator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_EclFilesComparator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
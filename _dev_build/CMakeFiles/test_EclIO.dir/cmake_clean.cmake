@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_EclIO.dir/tests/test_EclIO.cpp.o"
+  "CMakeFiles/test_EclIO.dir/tests/test_EclIO.cpp.o.d"
+  "bin/test_EclIO"
+  "bin/test_EclIO.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_EclIO.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_EclRegressionTest.dir/test_util/EclFilesComparator.cpp.o"
+  "CMakeFiles/test_EclRegressionTest.dir/test_util/EclFilesComparator.cpp.o.d"
+  "CMakeFiles/test_EclRegressionTest.dir/test_util/EclRegressionTest.cpp.o"
+  "CMakeFiles/test_EclRegressionTest.dir/test_util/EclRegressionTest.cpp.o.d"
+  "CMakeFiles/test_EclRegressionTest.dir/tests/test_EclRegressionTest.cpp.o"
+  "CMakeFiles/test_EclRegressionTest.dir/tests/test_EclRegressionTest.cpp.o.d"
+  "bin/test_EclRegressionTest"
+  "bin/test_EclRegressionTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_EclRegressionTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
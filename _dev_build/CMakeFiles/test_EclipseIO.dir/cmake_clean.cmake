@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_EclipseIO.dir/tests/test_EclipseIO.cpp.o"
+  "CMakeFiles/test_EclipseIO.dir/tests/test_EclipseIO.cpp.o.d"
+  "bin/test_EclipseIO"
+  "bin/test_EclipseIO.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_EclipseIO.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_InteHEAD.dir/tests/test_InteHEAD.cpp.o"
+  "CMakeFiles/test_InteHEAD.dir/tests/test_InteHEAD.cpp.o.d"
+  "bin/test_InteHEAD"
+  "bin/test_InteHEAD.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_InteHEAD.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
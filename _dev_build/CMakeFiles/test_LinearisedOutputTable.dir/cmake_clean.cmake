@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_LinearisedOutputTable.dir/tests/test_LinearisedOutputTable.cpp.o"
+  "CMakeFiles/test_LinearisedOutputTable.dir/tests/test_LinearisedOutputTable.cpp.o.d"
+  "bin/test_LinearisedOutputTable"
+  "bin/test_LinearisedOutputTable.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_LinearisedOutputTable.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_LogiHEAD.dir/tests/test_LogiHEAD.cpp.o"
+  "CMakeFiles/test_LogiHEAD.dir/tests/test_LogiHEAD.cpp.o.d"
+  "bin/test_LogiHEAD"
+  "bin/test_LogiHEAD.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_LogiHEAD.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
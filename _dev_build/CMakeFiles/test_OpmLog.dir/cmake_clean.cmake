@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_OpmLog.dir/tests/test_OpmLog.cpp.o"
+  "CMakeFiles/test_OpmLog.dir/tests/test_OpmLog.cpp.o.d"
+  "bin/test_OpmLog"
+  "bin/test_OpmLog.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_OpmLog.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_OutputStream.dir/tests/test_OutputStream.cpp.o"
+  "CMakeFiles/test_OutputStream.dir/tests/test_OutputStream.cpp.o.d"
+  "bin/test_OutputStream"
+  "bin/test_OutputStream.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_OutputStream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
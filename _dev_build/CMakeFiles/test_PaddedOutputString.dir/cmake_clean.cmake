@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_PaddedOutputString.dir/tests/test_PaddedOutputString.cpp.o"
+  "CMakeFiles/test_PaddedOutputString.dir/tests/test_PaddedOutputString.cpp.o.d"
+  "bin/test_PaddedOutputString"
+  "bin/test_PaddedOutputString.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_PaddedOutputString.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_RFT.dir/tests/test_RFT.cpp.o"
+  "CMakeFiles/test_RFT.dir/tests/test_RFT.cpp.o.d"
+  "bin/test_RFT"
+  "bin/test_RFT.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_RFT.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
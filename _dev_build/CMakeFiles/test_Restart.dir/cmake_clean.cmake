@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_Restart.dir/tests/test_Restart.cpp.o"
+  "CMakeFiles/test_Restart.dir/tests/test_Restart.cpp.o.d"
+  "bin/test_Restart"
+  "bin/test_Restart.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_Restart.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_SimulationDataContainer.dir/tests/test_SimulationDataContainer.cpp.o"
+  "CMakeFiles/test_SimulationDataContainer.dir/tests/test_SimulationDataContainer.cpp.o.d"
+  "bin/test_SimulationDataContainer"
+  "bin/test_SimulationDataContainer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_SimulationDataContainer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_Solution.dir/tests/test_Solution.cpp.o"
+  "CMakeFiles/test_Solution.dir/tests/test_Solution.cpp.o.d"
+  "bin/test_Solution"
+  "bin/test_Solution.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_Solution.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
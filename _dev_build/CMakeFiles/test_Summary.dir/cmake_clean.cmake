@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_Summary.dir/tests/test_Summary.cpp.o"
+  "CMakeFiles/test_Summary.dir/tests/test_Summary.cpp.o.d"
+  "bin/test_Summary"
+  "bin/test_Summary.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_Summary.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
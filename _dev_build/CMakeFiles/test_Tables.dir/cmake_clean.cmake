@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_Tables.dir/tests/test_Tables.cpp.o"
+  "CMakeFiles/test_Tables.dir/tests/test_Tables.cpp.o.d"
+  "bin/test_Tables"
+  "bin/test_Tables.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_Tables.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_Wells.dir/tests/test_Wells.cpp.o"
+  "CMakeFiles/test_Wells.dir/tests/test_Wells.cpp.o.d"
+  "bin/test_Wells"
+  "bin/test_Wells.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_Wells.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
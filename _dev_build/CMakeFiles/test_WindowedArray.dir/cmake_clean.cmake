@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_WindowedArray.dir/tests/test_WindowedArray.cpp.o"
+  "CMakeFiles/test_WindowedArray.dir/tests/test_WindowedArray.cpp.o.d"
+  "bin/test_WindowedArray"
+  "bin/test_WindowedArray.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_WindowedArray.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
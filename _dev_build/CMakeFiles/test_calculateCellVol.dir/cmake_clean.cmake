@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_calculateCellVol.dir/tests/test_calculateCellVol.cpp.o"
+  "CMakeFiles/test_calculateCellVol.dir/tests/test_calculateCellVol.cpp.o.d"
+  "bin/test_calculateCellVol"
+  "bin/test_calculateCellVol.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_calculateCellVol.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
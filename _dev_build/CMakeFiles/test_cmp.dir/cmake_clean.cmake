@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_cmp.dir/tests/test_cmp.cpp.o"
+  "CMakeFiles/test_cmp.dir/tests/test_cmp.cpp.o.d"
+  "bin/test_cmp"
+  "bin/test_cmp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cmp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
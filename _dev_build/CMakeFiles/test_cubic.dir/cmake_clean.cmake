@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_cubic.dir/tests/test_cubic.cpp.o"
+  "CMakeFiles/test_cubic.dir/tests/test_cubic.cpp.o.d"
+  "bin/test_cubic"
+  "bin/test_cubic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_cubic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_messagelimiter.dir/tests/test_messagelimiter.cpp.o"
+  "CMakeFiles/test_messagelimiter.dir/tests/test_messagelimiter.cpp.o.d"
+  "bin/test_messagelimiter"
+  "bin/test_messagelimiter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_messagelimiter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
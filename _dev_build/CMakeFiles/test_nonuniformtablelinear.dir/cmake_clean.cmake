@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_nonuniformtablelinear.dir/tests/test_nonuniformtablelinear.cpp.o"
+  "CMakeFiles/test_nonuniformtablelinear.dir/tests/test_nonuniformtablelinear.cpp.o.d"
+  "bin/test_nonuniformtablelinear"
+  "bin/test_nonuniformtablelinear.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_nonuniformtablelinear.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_param.dir/tests/test_param.cpp.o"
+  "CMakeFiles/test_param.dir/tests/test_param.cpp.o.d"
+  "bin/test_param"
+  "bin/test_param.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_param.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_regionCache.dir/tests/test_regionCache.cpp.o"
+  "CMakeFiles/test_regionCache.dir/tests/test_regionCache.cpp.o.d"
+  "bin/test_regionCache"
+  "bin/test_regionCache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_regionCache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
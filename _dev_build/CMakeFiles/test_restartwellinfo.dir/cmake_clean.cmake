@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_restartwellinfo.dir/tests/test_restartwellinfo.cpp.o"
+  "CMakeFiles/test_restartwellinfo.dir/tests/test_restartwellinfo.cpp.o.d"
+  "bin/test_restartwellinfo"
+  "bin/test_restartwellinfo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_restartwellinfo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
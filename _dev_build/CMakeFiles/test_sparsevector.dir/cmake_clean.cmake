@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_sparsevector.dir/tests/test_sparsevector.cpp.o"
+  "CMakeFiles/test_sparsevector.dir/tests/test_sparsevector.cpp.o.d"
+  "bin/test_sparsevector"
+  "bin/test_sparsevector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_sparsevector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
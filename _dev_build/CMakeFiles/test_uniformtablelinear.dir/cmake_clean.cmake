@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_uniformtablelinear.dir/tests/test_uniformtablelinear.cpp.o"
+  "CMakeFiles/test_uniformtablelinear.dir/tests/test_uniformtablelinear.cpp.o.d"
+  "bin/test_uniformtablelinear"
+  "bin/test_uniformtablelinear.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_uniformtablelinear.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
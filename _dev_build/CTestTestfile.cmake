@@ -0,0 +1,264 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_dev_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(InlineKeywordTest "/root/repo/_dev_build/bin/inlinekw")
+set_tests_properties(InlineKeywordTest PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/ExtraTests.cmake;6;opm_add_test;/root/repo/ExtraTests.cmake;0;;/root/repo/CMakeLists.txt;129;include;/root/repo/cmake/Modules/OpmLibMain.cmake;278;tests_hook;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(LoaderTest "/root/repo/_dev_build/bin/LoaderTest" "/root/repo/tests/parser/data/parser/keyword-generator/")
+set_tests_properties(LoaderTest PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/ExtraTests.cmake;16;opm_add_test;/root/repo/ExtraTests.cmake;0;;/root/repo/CMakeLists.txt;129;include;/root/repo/cmake/Modules/OpmLibMain.cmake;278;tests_hook;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(ParserTests "/root/repo/_dev_build/bin/ParserTests" "/root/repo/tests/parser/data/")
+set_tests_properties(ParserTests PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/ExtraTests.cmake;23;opm_add_test;/root/repo/ExtraTests.cmake;0;;/root/repo/CMakeLists.txt;129;include;/root/repo/cmake/Modules/OpmLibMain.cmake;278;tests_hook;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(ParserIncludeTests "/root/repo/_dev_build/bin/ParserIncludeTests" "/root/repo/tests/parser/data/parser/")
+set_tests_properties(ParserIncludeTests PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/ExtraTests.cmake;29;opm_add_test;/root/repo/ExtraTests.cmake;0;;/root/repo/CMakeLists.txt;129;include;/root/repo/cmake/Modules/OpmLibMain.cmake;278;tests_hook;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(PvtxTableTests "/root/repo/_dev_build/bin/PvtxTableTests" "/root/repo/tests/parser/data/integration_tests/")
+set_tests_properties(PvtxTableTests PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/ExtraTests.cmake;37;opm_add_test;/root/repo/ExtraTests.cmake;0;;/root/repo/CMakeLists.txt;129;include;/root/repo/cmake/Modules/OpmLibMain.cmake;278;tests_hook;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(EclipseStateTests "/root/repo/_dev_build/bin/EclipseStateTests" "/root/repo/tests/parser/data/integration_tests/")
+set_tests_properties(EclipseStateTests PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/ExtraTests.cmake;43;opm_add_test;/root/repo/ExtraTests.cmake;0;;/root/repo/CMakeLists.txt;129;include;/root/repo/cmake/Modules/OpmLibMain.cmake;278;tests_hook;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(BoxTest "/root/repo/_dev_build/bin/BoxTest" "/root/repo/tests/parser/data/integration_tests/")
+set_tests_properties(BoxTest PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/ExtraTests.cmake;62;opm_add_test;/root/repo/ExtraTests.cmake;0;;/root/repo/CMakeLists.txt;129;include;/root/repo/cmake/Modules/OpmLibMain.cmake;278;tests_hook;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(CheckDeckValidity "/root/repo/_dev_build/bin/CheckDeckValidity" "/root/repo/tests/parser/data/integration_tests/")
+set_tests_properties(CheckDeckValidity PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/ExtraTests.cmake;62;opm_add_test;/root/repo/ExtraTests.cmake;0;;/root/repo/CMakeLists.txt;129;include;/root/repo/cmake/Modules/OpmLibMain.cmake;278;tests_hook;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(EclipseGridCreateFromDeck "/root/repo/_dev_build/bin/EclipseGridCreateFromDeck" "/root/repo/tests/parser/data/integration_tests/")
+set_tests_properties(EclipseGridCreateFromDeck PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/ExtraTests.cmake;62;opm_add_test;/root/repo/ExtraTests.cmake;0;;/root/repo/CMakeLists.txt;129;include;/root/repo/cmake/Modules/OpmLibMain.cmake;278;tests_hook;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(EDITNNCTests "/root/repo/_dev_build/bin/EDITNNCTests" "/root/repo/tests/parser/data/integration_tests/")
+set_tests_properties(EDITNNCTests PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/ExtraTests.cmake;62;opm_add_test;/root/repo/ExtraTests.cmake;0;;/root/repo/CMakeLists.txt;129;include;/root/repo/cmake/Modules/OpmLibMain.cmake;278;tests_hook;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(IncludeTest "/root/repo/_dev_build/bin/IncludeTest" "/root/repo/tests/parser/data/integration_tests/")
+set_tests_properties(IncludeTest PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/ExtraTests.cmake;62;opm_add_test;/root/repo/ExtraTests.cmake;0;;/root/repo/CMakeLists.txt;129;include;/root/repo/cmake/Modules/OpmLibMain.cmake;278;tests_hook;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(IntegrationTests "/root/repo/_dev_build/bin/IntegrationTests" "/root/repo/tests/parser/data/integration_tests/")
+set_tests_properties(IntegrationTests PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/ExtraTests.cmake;62;opm_add_test;/root/repo/ExtraTests.cmake;0;;/root/repo/CMakeLists.txt;129;include;/root/repo/cmake/Modules/OpmLibMain.cmake;278;tests_hook;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(IOConfigIntegrationTest "/root/repo/_dev_build/bin/IOConfigIntegrationTest" "/root/repo/tests/parser/data/integration_tests/")
+set_tests_properties(IOConfigIntegrationTest PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/ExtraTests.cmake;62;opm_add_test;/root/repo/ExtraTests.cmake;0;;/root/repo/CMakeLists.txt;129;include;/root/repo/cmake/Modules/OpmLibMain.cmake;278;tests_hook;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(NNCTests "/root/repo/_dev_build/bin/NNCTests" "/root/repo/tests/parser/data/integration_tests/")
+set_tests_properties(NNCTests PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/ExtraTests.cmake;62;opm_add_test;/root/repo/ExtraTests.cmake;0;;/root/repo/CMakeLists.txt;129;include;/root/repo/cmake/Modules/OpmLibMain.cmake;278;tests_hook;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(ParseKEYWORD "/root/repo/_dev_build/bin/ParseKEYWORD" "/root/repo/tests/parser/data/integration_tests/")
+set_tests_properties(ParseKEYWORD PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/ExtraTests.cmake;62;opm_add_test;/root/repo/ExtraTests.cmake;0;;/root/repo/CMakeLists.txt;129;include;/root/repo/cmake/Modules/OpmLibMain.cmake;278;tests_hook;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(Polymer "/root/repo/_dev_build/bin/Polymer" "/root/repo/tests/parser/data/integration_tests/")
+set_tests_properties(Polymer PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/ExtraTests.cmake;62;opm_add_test;/root/repo/ExtraTests.cmake;0;;/root/repo/CMakeLists.txt;129;include;/root/repo/cmake/Modules/OpmLibMain.cmake;278;tests_hook;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(ScheduleCreateFromDeck "/root/repo/_dev_build/bin/ScheduleCreateFromDeck" "/root/repo/tests/parser/data/integration_tests/")
+set_tests_properties(ScheduleCreateFromDeck PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/ExtraTests.cmake;62;opm_add_test;/root/repo/ExtraTests.cmake;0;;/root/repo/CMakeLists.txt;129;include;/root/repo/cmake/Modules/OpmLibMain.cmake;278;tests_hook;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(TransMultIntegrationTests "/root/repo/_dev_build/bin/TransMultIntegrationTests" "/root/repo/tests/parser/data/integration_tests/")
+set_tests_properties(TransMultIntegrationTests PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/ExtraTests.cmake;62;opm_add_test;/root/repo/ExtraTests.cmake;0;;/root/repo/CMakeLists.txt;129;include;/root/repo/cmake/Modules/OpmLibMain.cmake;278;tests_hook;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(jsonTests "/root/repo/_dev_build/bin/jsonTests" "/root/repo/tests/json/example1.json")
+set_tests_properties(jsonTests PROPERTIES  WORKING_DIRECTORY "/root/repo" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/ExtraTests.cmake;105;opm_add_test;/root/repo/ExtraTests.cmake;0;;/root/repo/CMakeLists.txt;129;include;/root/repo/cmake/Modules/OpmLibMain.cmake;278;tests_hook;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(calculateCellVol "/root/repo/_dev_build/bin/test_calculateCellVol")
+set_tests_properties(calculateCellVol PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(cmp "/root/repo/_dev_build/bin/test_cmp")
+set_tests_properties(cmp PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(cubic "/root/repo/_dev_build/bin/test_cubic")
+set_tests_properties(cubic PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(messagelimiter "/root/repo/_dev_build/bin/test_messagelimiter")
+set_tests_properties(messagelimiter PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(nonuniformtablelinear "/root/repo/_dev_build/bin/test_nonuniformtablelinear")
+set_tests_properties(nonuniformtablelinear PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(OpmLog "/root/repo/_dev_build/bin/test_OpmLog")
+set_tests_properties(OpmLog PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(param "/root/repo/_dev_build/bin/test_param")
+set_tests_properties(param PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(SimulationDataContainer "/root/repo/_dev_build/bin/test_SimulationDataContainer")
+set_tests_properties(SimulationDataContainer PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(sparsevector "/root/repo/_dev_build/bin/test_sparsevector")
+set_tests_properties(sparsevector PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(uniformtablelinear "/root/repo/_dev_build/bin/test_uniformtablelinear")
+set_tests_properties(uniformtablelinear PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(ACTIONX "/root/repo/_dev_build/bin/ACTIONX")
+set_tests_properties(ACTIONX PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(ADDREGTests "/root/repo/_dev_build/bin/ADDREGTests")
+set_tests_properties(ADDREGTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(AquiferCTTests "/root/repo/_dev_build/bin/AquiferCTTests")
+set_tests_properties(AquiferCTTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(AquifetpTests "/root/repo/_dev_build/bin/AquifetpTests")
+set_tests_properties(AquifetpTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(AqudimsTests "/root/repo/_dev_build/bin/AqudimsTests")
+set_tests_properties(AqudimsTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(AquanconTests "/root/repo/_dev_build/bin/AquanconTests")
+set_tests_properties(AquanconTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(BoxTests "/root/repo/_dev_build/bin/BoxTests")
+set_tests_properties(BoxTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(ColumnSchemaTests "/root/repo/_dev_build/bin/ColumnSchemaTests")
+set_tests_properties(ColumnSchemaTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(ConnectionTests "/root/repo/_dev_build/bin/ConnectionTests")
+set_tests_properties(ConnectionTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(COMPSEGUnits "/root/repo/_dev_build/bin/COMPSEGUnits")
+set_tests_properties(COMPSEGUnits PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(CopyRegTests "/root/repo/_dev_build/bin/CopyRegTests")
+set_tests_properties(CopyRegTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(DeckValueTests "/root/repo/_dev_build/bin/DeckValueTests")
+set_tests_properties(DeckValueTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(DeckTests "/root/repo/_dev_build/bin/DeckTests")
+set_tests_properties(DeckTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(DynamicStateTests "/root/repo/_dev_build/bin/DynamicStateTests")
+set_tests_properties(DynamicStateTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(DynamicVectorTests "/root/repo/_dev_build/bin/DynamicVectorTests")
+set_tests_properties(DynamicVectorTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(Eclipse3DPropertiesTests "/root/repo/_dev_build/bin/Eclipse3DPropertiesTests")
+set_tests_properties(Eclipse3DPropertiesTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(EclipseGridTests "/root/repo/_dev_build/bin/EclipseGridTests")
+set_tests_properties(EclipseGridTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(EmbeddedPython "/root/repo/_dev_build/bin/EmbeddedPython")
+set_tests_properties(EmbeddedPython PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(EqualRegTests "/root/repo/_dev_build/bin/EqualRegTests")
+set_tests_properties(EqualRegTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(EventTests "/root/repo/_dev_build/bin/EventTests")
+set_tests_properties(EventTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(FaceDirTests "/root/repo/_dev_build/bin/FaceDirTests")
+set_tests_properties(FaceDirTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(FaultTests "/root/repo/_dev_build/bin/FaultTests")
+set_tests_properties(FaultTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(FoamTests "/root/repo/_dev_build/bin/FoamTests")
+set_tests_properties(FoamTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(FunctionalTests "/root/repo/_dev_build/bin/FunctionalTests")
+set_tests_properties(FunctionalTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(GeomodifierTests "/root/repo/_dev_build/bin/GeomodifierTests")
+set_tests_properties(GeomodifierTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(GridPropertyTests "/root/repo/_dev_build/bin/GridPropertyTests")
+set_tests_properties(GridPropertyTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(GroupTests "/root/repo/_dev_build/bin/GroupTests")
+set_tests_properties(GroupTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(InitConfigTest "/root/repo/_dev_build/bin/InitConfigTest")
+set_tests_properties(InitConfigTest PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(IOConfigTests "/root/repo/_dev_build/bin/IOConfigTests")
+set_tests_properties(IOConfigTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(MessageLimitTests "/root/repo/_dev_build/bin/MessageLimitTests")
+set_tests_properties(MessageLimitTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(MultiRegTests "/root/repo/_dev_build/bin/MultiRegTests")
+set_tests_properties(MultiRegTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(MultisegmentWellTests "/root/repo/_dev_build/bin/MultisegmentWellTests")
+set_tests_properties(MultisegmentWellTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(MULTREGTScannerTests "/root/repo/_dev_build/bin/MULTREGTScannerTests")
+set_tests_properties(MULTREGTScannerTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(OrderedMapTests "/root/repo/_dev_build/bin/OrderedMapTests")
+set_tests_properties(OrderedMapTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(ParseContextTests "/root/repo/_dev_build/bin/ParseContextTests")
+set_tests_properties(ParseContextTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(ParseContext_EXIT1 "/root/repo/_dev_build/bin/ParseContext_EXIT1")
+set_tests_properties(ParseContext_EXIT1 PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(ParseDATAWithDefault "/root/repo/_dev_build/bin/ParseDATAWithDefault")
+set_tests_properties(ParseDATAWithDefault PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(PYACTION "/root/repo/_dev_build/bin/PYACTION")
+set_tests_properties(PYACTION PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(PORVTests "/root/repo/_dev_build/bin/PORVTests")
+set_tests_properties(PORVTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(RawKeywordTests "/root/repo/_dev_build/bin/RawKeywordTests")
+set_tests_properties(RawKeywordTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(RawScannerTests "/root/repo/_dev_build/bin/RawScannerTests")
+set_tests_properties(RawScannerTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(ResinsightTest "/root/repo/_dev_build/bin/ResinsightTest")
+set_tests_properties(ResinsightTest PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(RestartConfigTests "/root/repo/_dev_build/bin/RestartConfigTests")
+set_tests_properties(RestartConfigTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(RockTableTests "/root/repo/_dev_build/bin/RockTableTests")
+set_tests_properties(RockTableTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(RunspecTests "/root/repo/_dev_build/bin/RunspecTests")
+set_tests_properties(RunspecTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(SatfuncPropertyInitializersTests "/root/repo/_dev_build/bin/SatfuncPropertyInitializersTests")
+set_tests_properties(SatfuncPropertyInitializersTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(ScheduleTests "/root/repo/_dev_build/bin/ScheduleTests")
+set_tests_properties(ScheduleTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(SectionTests "/root/repo/_dev_build/bin/SectionTests")
+set_tests_properties(SectionTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(SimpleTableTests "/root/repo/_dev_build/bin/SimpleTableTests")
+set_tests_properties(SimpleTableTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(SimulationConfigTest "/root/repo/_dev_build/bin/SimulationConfigTest")
+set_tests_properties(SimulationConfigTest PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(StarTokenTests "/root/repo/_dev_build/bin/StarTokenTests")
+set_tests_properties(StarTokenTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(StringTests "/root/repo/_dev_build/bin/StringTests")
+set_tests_properties(StringTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(SummaryConfigTests "/root/repo/_dev_build/bin/SummaryConfigTests")
+set_tests_properties(SummaryConfigTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(TabdimsTests "/root/repo/_dev_build/bin/TabdimsTests")
+set_tests_properties(TabdimsTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(TableColumnTests "/root/repo/_dev_build/bin/TableColumnTests")
+set_tests_properties(TableColumnTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(TableContainerTests "/root/repo/_dev_build/bin/TableContainerTests")
+set_tests_properties(TableContainerTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(TableManagerTests "/root/repo/_dev_build/bin/TableManagerTests")
+set_tests_properties(TableManagerTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(TableSchemaTests "/root/repo/_dev_build/bin/TableSchemaTests")
+set_tests_properties(TableSchemaTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(ThresholdPressureTest "/root/repo/_dev_build/bin/ThresholdPressureTest")
+set_tests_properties(ThresholdPressureTest PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(TimeMapTest "/root/repo/_dev_build/bin/TimeMapTest")
+set_tests_properties(TimeMapTest PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(TransMultTests "/root/repo/_dev_build/bin/TransMultTests")
+set_tests_properties(TransMultTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(TuningTests "/root/repo/_dev_build/bin/TuningTests")
+set_tests_properties(TuningTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(UDQTests "/root/repo/_dev_build/bin/UDQTests")
+set_tests_properties(UDQTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(UnitTests "/root/repo/_dev_build/bin/UnitTests")
+set_tests_properties(UnitTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(ValueTests "/root/repo/_dev_build/bin/ValueTests")
+set_tests_properties(ValueTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(WellSolventTests "/root/repo/_dev_build/bin/WellSolventTests")
+set_tests_properties(WellSolventTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(WellTracerTests "/root/repo/_dev_build/bin/WellTracerTests")
+set_tests_properties(WellTracerTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(WellTests "/root/repo/_dev_build/bin/WellTests")
+set_tests_properties(WellTests PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(WLIST "/root/repo/_dev_build/bin/WLIST")
+set_tests_properties(WLIST PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(WTEST "/root/repo/_dev_build/bin/WTEST")
+set_tests_properties(WTEST PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(AggregateActionxData "/root/repo/_dev_build/bin/test_AggregateActionxData")
+set_tests_properties(AggregateActionxData PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(AggregateWellData "/root/repo/_dev_build/bin/test_AggregateWellData")
+set_tests_properties(AggregateWellData PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(AggregateGroupData "/root/repo/_dev_build/bin/test_AggregateGroupData")
+set_tests_properties(AggregateGroupData PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(AggregateMSWData "/root/repo/_dev_build/bin/test_AggregateMSWData")
+set_tests_properties(AggregateMSWData PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(AggregateConnectionData "/root/repo/_dev_build/bin/test_AggregateConnectionData")
+set_tests_properties(AggregateConnectionData PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(AggregateUDQData "/root/repo/_dev_build/bin/test_AggregateUDQData")
+set_tests_properties(AggregateUDQData PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(ArrayDimChecker "/root/repo/_dev_build/bin/test_ArrayDimChecker")
+set_tests_properties(ArrayDimChecker PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(EclipseIO "/root/repo/_dev_build/bin/test_EclipseIO")
+set_tests_properties(EclipseIO PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(DoubHEAD "/root/repo/_dev_build/bin/test_DoubHEAD")
+set_tests_properties(DoubHEAD PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(InteHEAD "/root/repo/_dev_build/bin/test_InteHEAD")
+set_tests_properties(InteHEAD PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(LinearisedOutputTable "/root/repo/_dev_build/bin/test_LinearisedOutputTable")
+set_tests_properties(LinearisedOutputTable PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(LogiHEAD "/root/repo/_dev_build/bin/test_LogiHEAD")
+set_tests_properties(LogiHEAD PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(OutputStream "/root/repo/_dev_build/bin/test_OutputStream")
+set_tests_properties(OutputStream PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(regionCache "/root/repo/_dev_build/bin/test_regionCache")
+set_tests_properties(regionCache PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(PaddedOutputString "/root/repo/_dev_build/bin/test_PaddedOutputString")
+set_tests_properties(PaddedOutputString PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(Restart "/root/repo/_dev_build/bin/test_Restart")
+set_tests_properties(Restart PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(RFT "/root/repo/_dev_build/bin/test_RFT")
+set_tests_properties(RFT PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(Solution "/root/repo/_dev_build/bin/test_Solution")
+set_tests_properties(Solution PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(Summary "/root/repo/_dev_build/bin/test_Summary")
+set_tests_properties(Summary PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(Tables "/root/repo/_dev_build/bin/test_Tables")
+set_tests_properties(Tables PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(Wells "/root/repo/_dev_build/bin/test_Wells")
+set_tests_properties(Wells PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(WindowedArray "/root/repo/_dev_build/bin/test_WindowedArray")
+set_tests_properties(WindowedArray PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(restartwellinfo "/root/repo/_dev_build/bin/test_restartwellinfo")
+set_tests_properties(restartwellinfo PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;104;add_test;/root/repo/cmake/Modules/OpmLibMain.cmake;286;opm_compile_satellites;/root/repo/cmake/Modules/OpmLibMain.cmake;0;;/root/repo/CMakeLists.txt;140;include;/root/repo/CMakeLists.txt;0;")
+add_test(EclFilesComparator "/root/repo/_dev_build/bin/test_EclFilesComparator")
+set_tests_properties(EclFilesComparator PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/CMakeLists.txt;193;opm_add_test;/root/repo/CMakeLists.txt;0;")
+add_test(EclRegressionTest "/root/repo/_dev_build/bin/test_EclRegressionTest")
+set_tests_properties(EclRegressionTest PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/CMakeLists.txt;205;opm_add_test;/root/repo/CMakeLists.txt;0;")
+add_test(EclIO "/root/repo/_dev_build/bin/test_EclIO")
+set_tests_properties(EclIO PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/CMakeLists.txt;219;opm_add_test;/root/repo/CMakeLists.txt;0;")
+add_test(EGrid "/root/repo/_dev_build/bin/test_EGrid")
+set_tests_properties(EGrid PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/CMakeLists.txt;219;opm_add_test;/root/repo/CMakeLists.txt;0;")
+add_test(ERft "/root/repo/_dev_build/bin/test_ERft")
+set_tests_properties(ERft PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/CMakeLists.txt;219;opm_add_test;/root/repo/CMakeLists.txt;0;")
+add_test(ERst "/root/repo/_dev_build/bin/test_ERst")
+set_tests_properties(ERst PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/CMakeLists.txt;219;opm_add_test;/root/repo/CMakeLists.txt;0;")
+add_test(ESmry "/root/repo/_dev_build/bin/test_ESmry")
+set_tests_properties(ESmry PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/tests" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/OpmSatellites.cmake;345;add_test;/root/repo/CMakeLists.txt;219;opm_add_test;/root/repo/CMakeLists.txt;0;")
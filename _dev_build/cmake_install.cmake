@@ -0,0 +1,1273 @@
+# Install script for directory: /root/repo
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include" TYPE DIRECTORY FILES "/root/repo/_dev_build/include/" REGEX "/[^/]*\\.hpp$")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common" TYPE FILE FILES "/root/repo/opm/common/ErrorMacros.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common" TYPE FILE FILES "/root/repo/opm/common/Exceptions.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/data" TYPE FILE FILES "/root/repo/opm/common/data/SimulationDataContainer.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/OpmLog" TYPE FILE FILES "/root/repo/opm/common/OpmLog/AsyncLogBackend.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/OpmLog" TYPE FILE FILES "/root/repo/opm/common/OpmLog/CounterLog.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/OpmLog" TYPE FILE FILES "/root/repo/opm/common/OpmLog/EclipsePRTLog.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/OpmLog" TYPE FILE FILES "/root/repo/opm/common/OpmLog/LogBackend.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/OpmLog" TYPE FILE FILES "/root/repo/opm/common/OpmLog/Logger.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/OpmLog" TYPE FILE FILES "/root/repo/opm/common/OpmLog/LogUtil.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/OpmLog" TYPE FILE FILES "/root/repo/opm/common/OpmLog/MessageFormatter.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/OpmLog" TYPE FILE FILES "/root/repo/opm/common/OpmLog/MessageLimiter.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/OpmLog" TYPE FILE FILES "/root/repo/opm/common/OpmLog/Location.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/OpmLog" TYPE FILE FILES "/root/repo/opm/common/OpmLog/OpmLog.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/OpmLog" TYPE FILE FILES "/root/repo/opm/common/OpmLog/StreamLog.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/OpmLog" TYPE FILE FILES "/root/repo/opm/common/OpmLog/TimerLog.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility/numeric" TYPE FILE FILES "/root/repo/opm/common/utility/numeric/cmp.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility/platform_dependent" TYPE FILE FILES "/root/repo/opm/common/utility/platform_dependent/disable_warnings.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility/platform_dependent" TYPE FILE FILES "/root/repo/opm/common/utility/platform_dependent/reenable_warnings.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility/numeric" TYPE FILE FILES "/root/repo/opm/common/utility/numeric/blas_lapack.h")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility/numeric" TYPE FILE FILES "/root/repo/opm/common/utility/numeric/buildUniformMonotoneTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility/numeric" TYPE FILE FILES "/root/repo/opm/common/utility/numeric/linearInterpolation.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility/numeric" TYPE FILE FILES "/root/repo/opm/common/utility/numeric/MonotCubicInterpolator.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility/numeric" TYPE FILE FILES "/root/repo/opm/common/utility/numeric/NonuniformTableLinear.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility/numeric" TYPE FILE FILES "/root/repo/opm/common/utility/numeric/RootFinders.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility/numeric" TYPE FILE FILES "/root/repo/opm/common/utility/numeric/SparseVector.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility/numeric" TYPE FILE FILES "/root/repo/opm/common/utility/numeric/UniformTableLinear.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility/parameters" TYPE FILE FILES "/root/repo/opm/common/utility/parameters/ParameterGroup.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility/parameters" TYPE FILE FILES "/root/repo/opm/common/utility/parameters/ParameterGroup_impl.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility/parameters" TYPE FILE FILES "/root/repo/opm/common/utility/parameters/Parameter.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility/parameters" TYPE FILE FILES "/root/repo/opm/common/utility/parameters/ParameterMapItem.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility/parameters" TYPE FILE FILES "/root/repo/opm/common/utility/parameters/ParameterRequirement.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility/parameters" TYPE FILE FILES "/root/repo/opm/common/utility/parameters/ParameterStrings.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility/parameters" TYPE FILE FILES "/root/repo/opm/common/utility/parameters/ParameterTools.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility/numeric" TYPE FILE FILES "/root/repo/opm/common/utility/numeric/calculateCellVol.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/common/utility" TYPE FILE FILES "/root/repo/opm/common/utility/TimeService.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/json" TYPE FILE FILES "/root/repo/opm/json/JsonObject.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Utility" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Utility/Stringview.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Utility" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Utility/Functional.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Utility" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Utility/Typetools.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Utility" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Utility/String.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Generator" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Generator/KeywordGenerator.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Generator" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Generator/KeywordLoader.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Units" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Units/UnitSystem.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Units" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Units/Units.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Units" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Units/Dimension.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Parser" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Parser/ErrorGuard.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Parser" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Parser/IncludeCache.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Parser" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Parser/ParserItem.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Parser" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Parser/Parser.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Parser" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Parser/ParserRecord.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Parser" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Parser/ParserKeyword.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Parser" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Parser/InputErrorAction.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Parser" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Parser/ParserEnums.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Parser" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Parser/ParseContext.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Parser" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Parser/ParseProfile.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Parser" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Parser/ParserConst.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/InitConfig" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/InitConfig/InitConfig.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/InitConfig" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/InitConfig/Equil.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/InitConfig" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/InitConfig/FoamConfig.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Util" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Util/Value.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Util" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Util/IOrderSet.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Util" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Util/OrderedMap.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/SummaryConfig" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Edit" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Edit/EDITNNC.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Grid" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Grid/GridDims.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Grid" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Grid/TransMult.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Grid" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Grid/GridProperties.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Grid" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Grid/PinchMode.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Grid" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Grid/MULTREGTScanner.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Grid" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Grid/FaultCollection.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Grid" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Grid/SatfuncPropertyInitializers.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Grid" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Grid/Fault.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Grid" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Grid/Box.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Grid" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Grid/GridProperty.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Grid" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Grid/FaultFace.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Grid" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Grid/NNC.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Grid" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Grid/EclipseGrid.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Grid" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Grid/BoxManager.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Grid" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Grid/FaceDir.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Grid" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Grid/MinpvMode.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Eclipse3DProperties.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/EndpointScaling.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/SimpleTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/PolyInjTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/PdvdTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/TlpmixpaTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/PvdgTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/MsfnTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/GasvisctTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/Regdims.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/Eqldims.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/SpecrockTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/PlydhflfTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/PlymwinjTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/PlyshlogTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/RsvdTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/SkprwatTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/SkprpolyTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/SpecheatTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/SgcwmisTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/Sof2Table.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/TableManager.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/SwfnTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/EnptvdTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/SwofTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/FlatTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/Aqudims.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/JFunc.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/TableIndex.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/PvtgTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/Tabdims.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/TableSchema.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/RocktabTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/EnkrvdTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/PlyrockTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/PvtxTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/WatvisctTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/TableEnums.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/RvvdTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/TableContainer.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/AqutabTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/PlyadsTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/FoamadsTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/FoammobTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/PbvdTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/SorwmisTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/PlymaxTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/PlyviscTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/TableColumn.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/SsfnTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/PvdoTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/OilvisctTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/SgfnTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/MiscTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/SgwfnTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/PvdsTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/PvtoTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/Rock2dTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/Rock2dtrTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/RockwnodTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/OverburdTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/ColumnSchema.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/PmiscTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/RtempvdTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/SlgofTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/ImptvdTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/ImkrvdTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/Sof3Table.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Tables" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Tables/SgofTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/EclipseState.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/EclipseConfig.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Aquancon.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/AquiferCT.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Aquifetp.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Action" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Action/ActionAST.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Action" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Action/ActionContext.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Action" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Action/ActionResult.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Action" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Action/Actdims.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Action" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Action/Actions.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Action" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Action/ActionX.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Action" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Action/Condition.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/ArrayDimChecker.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/TimeMap.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/VFPInjTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/VFPProdTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Well" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Well/Connection.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Well" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Well/ProductionControls.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Well" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Well/InjectionControls.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Well" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Well/Well2.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Well" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Well/WList.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Well" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Well/WListManager.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Well" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Well/WellEconProductionLimits.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Well" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Well/WellFoamProperties.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Well" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Well/WellInjectionProperties.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Well" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Well/WellPolymerProperties.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Well" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Well/WellProductionProperties.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Well" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Well/WellTracerProperties.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Well" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Well/WellTestConfig.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Well" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Well/WellTestState.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Well" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Well/WellConnections.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/DynamicVector.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/SummaryState.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/RFTConfig.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Tuning.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Group" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Group/GTNode.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Group" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Group/Group2.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Group" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Group/GuideRate.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Group" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Group/GuideRateConfig.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/Group" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Group/GuideRateModel.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/MessageLimits.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/Events.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/OilVaporizationProperties.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/DynamicState.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/MSW" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/MSW/Segment.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/MSW" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/MSW/WellSegments.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/MSW" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/MSW/updatingConnectionsWithSegments.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/SimulationConfig" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/SimulationConfig/ThresholdPressure.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/SimulationConfig" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/SimulationConfig/SimulationConfig.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/IOConfig" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/IOConfig/RestartConfig.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/IOConfig" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/IOConfig/IOConfig.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/checkDeck.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Runspec.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/UDQ" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQAssign.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/UDQ" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQDefine.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/UDQ" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQContext.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/UDQ" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQConfig.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/UDQ" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQEnums.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/UDQ" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQParams.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/UDQ" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQInput.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/UDQ" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQActive.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/UDQ" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQSet.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/UDQ" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunction.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/EclipseState/Schedule/UDQ" TYPE FILE FILES "/root/repo/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunctionTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Deck" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Deck/DeckItem.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Deck" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Deck/Deck.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Deck" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Deck/Section.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Deck" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Deck/DeckOutput.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Deck" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Deck/DeckValue.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Deck" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Deck/DeckKeyword.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Deck" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Deck/DeckRecord.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Deck" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Deck/UDAValue.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/parser/eclipse/Python" TYPE FILE FILES "/root/repo/opm/parser/eclipse/Python/Python.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/io/eclipse" TYPE FILE FILES "/root/repo/opm/io/eclipse/EclFile.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/io/eclipse" TYPE FILE FILES "/root/repo/opm/io/eclipse/EclIOdata.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/io/eclipse" TYPE FILE FILES "/root/repo/opm/io/eclipse/EclOutput.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/io/eclipse" TYPE FILE FILES "/root/repo/opm/io/eclipse/EclUtil.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/io/eclipse" TYPE FILE FILES "/root/repo/opm/io/eclipse/EGrid.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/io/eclipse" TYPE FILE FILES "/root/repo/opm/io/eclipse/ERft.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/io/eclipse" TYPE FILE FILES "/root/repo/opm/io/eclipse/ERst.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/io/eclipse" TYPE FILE FILES "/root/repo/opm/io/eclipse/ESmry.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/io/eclipse" TYPE FILE FILES "/root/repo/opm/io/eclipse/PaddedOutputString.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/io/eclipse" TYPE FILE FILES "/root/repo/opm/io/eclipse/OutputStream.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/data" TYPE FILE FILES "/root/repo/opm/output/data/Cells.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/data" TYPE FILE FILES "/root/repo/opm/output/data/Solution.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/data" TYPE FILE FILES "/root/repo/opm/output/data/Wells.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse/VectorItems" TYPE FILE FILES "/root/repo/opm/output/eclipse/VectorItems/connection.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse/VectorItems" TYPE FILE FILES "/root/repo/opm/output/eclipse/VectorItems/group.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse/VectorItems" TYPE FILE FILES "/root/repo/opm/output/eclipse/VectorItems/intehead.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse/VectorItems" TYPE FILE FILES "/root/repo/opm/output/eclipse/VectorItems/logihead.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse/VectorItems" TYPE FILE FILES "/root/repo/opm/output/eclipse/VectorItems/msw.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse/VectorItems" TYPE FILE FILES "/root/repo/opm/output/eclipse/VectorItems/tabdims.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse/VectorItems" TYPE FILE FILES "/root/repo/opm/output/eclipse/VectorItems/well.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/AggregateActionxData.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/AggregateGroupData.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/AggregateConnectionData.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/AggregateMSWData.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/AggregateUDQData.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/AggregateWellData.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/DoubHEAD.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/EclipseGridInspector.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/EclipseIO.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/EclipseIOUtil.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/InteHEAD.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/LinearisedOutputTable.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/LogiHEAD.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/RegionCache.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/RestartIO.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/RestartValue.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/Summary.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/Tables.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/WindowedArray.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/WriteInit.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/WriteRFT.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output/eclipse" TYPE FILE FILES "/root/repo/opm/output/eclipse/WriteRestartHelpers.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/opm/output" TYPE FILE FILES "/root/repo/opm/output/OutputWriter.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_dev_build/lib/libopmcommon.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/share/cmake/opm-common/opm-common-targets.cmake")
+    file(DIFFERENT _cmake_export_file_changed FILES
+         "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/share/cmake/opm-common/opm-common-targets.cmake"
+         "/root/repo/_dev_build/CMakeFiles/Export/27dcfeeae7d0de6edde3a8d2683f0dea/opm-common-targets.cmake")
+    if(_cmake_export_file_changed)
+      file(GLOB _cmake_old_config_files "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/share/cmake/opm-common/opm-common-targets-*.cmake")
+      if(_cmake_old_config_files)
+        string(REPLACE ";" ", " _cmake_old_config_files_text "${_cmake_old_config_files}")
+        message(STATUS "Old export file \"$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/share/cmake/opm-common/opm-common-targets.cmake\" will be replaced.  Removing files [${_cmake_old_config_files_text}].")
+        unset(_cmake_old_config_files_text)
+        file(REMOVE ${_cmake_old_config_files})
+      endif()
+      unset(_cmake_old_config_files)
+    endif()
+    unset(_cmake_export_file_changed)
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/share/cmake/opm-common" TYPE FILE FILES "/root/repo/_dev_build/CMakeFiles/Export/27dcfeeae7d0de6edde3a8d2683f0dea/opm-common-targets.cmake")
+  if(CMAKE_INSTALL_CONFIG_NAME MATCHES "^([Dd][Ee][Bb][Uu][Gg])$")
+    file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/share/cmake/opm-common" TYPE FILE FILES "/root/repo/_dev_build/CMakeFiles/Export/27dcfeeae7d0de6edde3a8d2683f0dea/opm-common-targets-debug.cmake")
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/dunecontrol/opm-common" TYPE FILE FILES "/root/repo/dune.module")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  list(APPEND CMAKE_ABSOLUTE_DESTINATION_FILES
+   "/usr/local/share/opm/cmake/Modules/opm-common-prereqs.cmake")
+  if(CMAKE_WARN_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(WARNING "ABSOLUTE path INSTALL DESTINATION : ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  if(CMAKE_ERROR_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(FATAL_ERROR "ABSOLUTE path INSTALL DESTINATION forbidden (by caller): ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  file(INSTALL DESTINATION "/usr/local/share/opm/cmake/Modules" TYPE FILE FILES "/root/repo/opm-common-prereqs.cmake")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/share/cmake/opm-common" TYPE FILE RENAME "opm-common-config.cmake" FILES "/root/repo/_dev_build/opm-common-install.cmake")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/share/cmake/opm-common" TYPE FILE FILES "/root/repo/_dev_build/opm-common-config-version.cmake")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  list(APPEND CMAKE_ABSOLUTE_DESTINATION_FILES
+   "/usr/local/lib/pkgconfig/opm-common.pc")
+  if(CMAKE_WARN_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(WARNING "ABSOLUTE path INSTALL DESTINATION : ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  if(CMAKE_ERROR_ON_ABSOLUTE_INSTALL_DESTINATION)
+    message(FATAL_ERROR "ABSOLUTE path INSTALL DESTINATION forbidden (by caller): ${CMAKE_ABSOLUTE_DESTINATION_FILES}")
+  endif()
+  file(INSTALL DESTINATION "/usr/local/lib/pkgconfig" TYPE FILE RENAME "opm-common.pc" FILES "/root/repo/_dev_build/opm-common-install.pc")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/opmi" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/opmi")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/opmi"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/bin" TYPE EXECUTABLE FILES "/root/repo/_dev_build/bin/opmi")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/opmi" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/opmi")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/opmi")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/opmpack" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/opmpack")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/opmpack"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/bin" TYPE EXECUTABLE FILES "/root/repo/_dev_build/bin/opmpack")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/opmpack" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/opmpack")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/opmpack")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/opmhash" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/opmhash")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/opmhash"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/bin" TYPE EXECUTABLE FILES "/root/repo/_dev_build/bin/opmhash")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/opmhash" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/opmhash")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/opmhash")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/compareECL" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/compareECL")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/compareECL"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/bin" TYPE EXECUTABLE FILES "/root/repo/_dev_build/bin/compareECL")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/compareECL" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/compareECL")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/compareECL")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/convertECL" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/convertECL")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/convertECL"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/bin" TYPE EXECUTABLE FILES "/root/repo/_dev_build/bin/convertECL")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/convertECL" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/convertECL")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/bin/convertECL")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/share/opm" TYPE DIRECTORY FILES "/root/repo/cmake")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/share/opm/etc" TYPE FILE FILES "/root/repo/etc/opm_bash_completion.sh.in")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT)
+  set(CMAKE_INSTALL_MANIFEST "install_manifest_${CMAKE_INSTALL_COMPONENT}.txt")
+else()
+  set(CMAKE_INSTALL_MANIFEST "install_manifest.txt")
+endif()
+
+string(REPLACE ";" "\n" CMAKE_INSTALL_MANIFEST_CONTENT
+       "${CMAKE_INSTALL_MANIFEST_FILES}")
+file(WRITE "/root/repo/_dev_build/${CMAKE_INSTALL_MANIFEST}"
+     "${CMAKE_INSTALL_MANIFEST_CONTENT}")
@@ -0,0 +1,3 @@
+#define HAS_ATTRIBUTE_UNUSED 1
+#define HAVE_ZLIB 1
+#define HAVE_DYNAMIC_BOOST_TEST 1